@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "regexp4.h"
@@ -10,6 +11,15 @@ void printCatch(){
     printf( "#%d# >%.*s<\n", i, lenCatch( i ), gpsCatch( i ) );
 }
 
+int growArena( struct ARENA *arena, const int size ){
+  char *mem = realloc( arena->mem, 2 * size );
+  if( mem == NULL ) return 0;
+
+  arena->mem  = mem;
+  arena->size = 2 * size;
+  return 1;
+}
+
 int raptorTest(){
   int result = 0;
   int errs   = 0;
@@ -1204,6 +1214,342 @@ int raptorTest(){
   PUT_TEST( "<url>https://en.wikipedia.org/wiki/Regular_expression<url>", "(https?|ftp):://<[^:s/:<:>]+></[^:s:.:<:>,/]+>*<.>*", "[#1][#2][#3]", "[en.wikipedia.org][/wiki/Regular_expression][<url>]" );
 
 
+  struct RAPTOR  raptor, other;
+  struct CONTEXT ctx, ctxOther;
+  char           found[ 512 ], wide[ 16384 ];
+  struct CAPTURE fixed[ 11 ];
+  struct TRACK   track[ 4 ];
+  char           cache[ 4096 ];
+  struct ARENA   arena = { NULL, 0, 0, growArena }, small = { (char *)fixed, sizeof fixed, 0, NULL };
+  struct ARENA   raptorArena = { NULL, 0, 0, growArena }, otherArena = { NULL, 0, 0, growArena };
+
+  initCatchCtx( &ctx     , NULL );
+  initCatchCtx( &ctxOther, NULL );
+
+#define RAPTOR_LEN_COMPILE( raptor, re, len )           \
+  ( raptor##Arena.used = 0, compileRaptor( &raptor, &raptor##Arena, re, len ) )
+
+#define RAPTOR_COMPILE( raptor, re )                    \
+  RAPTOR_LEN_COMPILE( raptor, re, strlen( re ) )
+
+#define RAPTOR_LEN_TEST( text, len, n )                 \
+  result = matchRaptor( &ctx, &raptor, text, len );     \
+  total++;                                              \
+  if( result != n ){                                    \
+    printf( "%s:%d Error on RAPTOR-TEST >%s<\n",        \
+            __FILE__, __LINE__, text );                 \
+    printf( "results %d - %d expected\n", result, n );  \
+    errs++;                                             \
+  }
+
+#define RAPTOR_TEST( text, n )                          \
+  RAPTOR_LEN_TEST( text, strlen( text ), n )
+
+#define RAPTOR_PUT_TEST( text, rtext, ctext )           \
+  result = matchRaptor( &ctx, &raptor, text, strlen( text ) ); \
+  total++;                                              \
+  if( strcmp( putCatchCtx( &ctx, str, rtext ), ctext ) != 0 ){ \
+    printf( "%s:%d Error on RAPTOR " text "\n",         \
+            __FILE__, __LINE__ );                       \
+    printf( "result    >>%s<<\n"                        \
+            "expected  >>%s<<\n", str, ctext );         \
+    errs++;                                             \
+  }
+
+#define RAPTOR_FIND_TEST( text, rtext, ctext )          \
+  found[0] = '\0';                                      \
+  for( int offset = 0; findRaptor( &ctx, &raptor, text, strlen( text ), &offset ); ) \
+    sprintf( found + strlen( found ), "%.*s%s|",        \
+             lenMatchCtx( &ctx ), gpsMatchCtx( &ctx ),  \
+             putCatchCtx( &ctx, str, rtext ) );         \
+  total++;                                              \
+  if( strcmp( found, ctext ) != 0 ){                    \
+    printf( "%s:%d Error on RAPTOR-FIND " text "\n",    \
+            __FILE__, __LINE__ );                       \
+    printf( "result    >>%s<<\n"                        \
+            "expected  >>%s<<\n", found, ctext );       \
+    errs++;                                             \
+  }
+
+#define RAPTOR_SAME_TEST( text, re, rtext )             \
+  RAPTOR_COMPILE( raptor, re );                         \
+  result = matchRaptor( &ctx, &raptor, text, strlen( text ) ); \
+  putCatchCtx( &ctx, found, rtext );                    \
+  total++;                                              \
+  if( result != regexp4( text, re ) || strcmp( putCatch( str, rtext ), found ) != 0 ){ \
+    printf( "%s:%d Error on RAPTOR-SAME >%s< >%s<\n",   \
+            __FILE__, __LINE__, text, re );             \
+    printf( "result    >>%d %s<<\n"                     \
+            "expected  >>%d %s<<\n", result, found, regexp4( text, re ), str ); \
+    errs++;                                             \
+  }
+
+  RAPTOR_COMPILE( raptor, "<:d+>-<:d+>" );
+  RAPTOR_TEST( "1-2", 1 );
+  RAPTOR_TEST( "1-2 33-44 x-5", 2 );
+  RAPTOR_TEST( "x-y", 0 );
+  RAPTOR_TEST( "", 0 );
+  RAPTOR_PUT_TEST( "10-20", "#2-#1", "20-10" );
+  RAPTOR_PUT_TEST( "1-2 33-44", "#4-#3-#2-#1", "44-33-2-1" );
+
+  RAPTOR_COMPILE( raptor, "#^$*RaPtOr|T Rex" );
+  RAPTOR_TEST( "raptor", 1 );
+  RAPTOR_TEST( "t rex", 1 );
+  RAPTOR_TEST( "raptors", 0 );
+
+  RAPTOR_COMPILE( raptor, "" );
+  RAPTOR_TEST( "raptor", 0 );
+
+  RAPTOR_COMPILE( raptor, "Raptor:d" );
+  RAPTOR_TEST( "Raptor Raptor1 RaptoR2 Raptor3", 2 );
+  RAPTOR_TEST( "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxRaptor", 0 );
+  RAPTOR_TEST( "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxRaptor9", 1 );
+  RAPTOR_COMPILE( raptor, "#^Raptor" );
+  RAPTOR_TEST( "xRaptor", 0 );
+  RAPTOR_COMPILE( raptor, "ab+c" );
+  RAPTOR_TEST( "aaaaaaaaaaaaaaaaaaaaaaabbbc ac abc", 2 );
+  RAPTOR_COMPILE( raptor, "(x|y)?[0-9]+|:a:d" );
+  RAPTOR_TEST( "--------------------------------------7-----y8---a9", 3 );
+  RAPTOR_COMPILE( raptor, "#*(Dinosaur|T Rex|Raptor)" );
+  RAPTOR_TEST( "...............................t rex ........ rAPTOR", 2 );
+  RAPTOR_COMPILE( raptor, "x*" );
+  RAPTOR_TEST( "--x-", 4 );
+  RAPTOR_COMPILE( raptor, "<[^,]+>,<.{2,3}><:d{2}><x*>" );
+  RAPTOR_PUT_TEST( "a long field,ab1234xx", "#1|#2|#3|#4", "a long field|ab1|23|" );
+  RAPTOR_PUT_TEST( "a,bc123xxx", "#1|#2|#3|#4", "a|bc1|23|xxx" );
+  RAPTOR_TEST( "a,bcd1", 0 );
+  RAPTOR_COMPILE( raptor, "#*<[a-c]{3,}>x{2}" );
+  RAPTOR_PUT_TEST( "ABcabc xx ccxx cCcxx", "#1", "cCc" );
+
+  RAPTOR_LEN_COMPILE( raptor, "x\0y", 3 );
+  RAPTOR_LEN_TEST( "--x\0y--x", 8, 1 );
+  RAPTOR_LEN_TEST( "--xy", 4, 0 );
+  RAPTOR_COMPILE( raptor, "a.b" );
+  RAPTOR_LEN_TEST( "a\0b", 3, 1 );
+  RAPTOR_COMPILE( raptor, "[^a]+" );
+  RAPTOR_LEN_TEST( "a\0\0a", 4, 1 );
+  RAPTOR_COMPILE( raptor, "#$c" );
+  RAPTOR_LEN_TEST( "abcabc", 3, 1 );
+  RAPTOR_LEN_TEST( "abcabc", 2, 0 );
+  RAPTOR_LEN_COMPILE( raptor, "abc{2}", 3 );
+  RAPTOR_TEST( "abc", 1 );
+  RAPTOR_LEN_COMPILE( raptor, "a{2}", 3 );
+  RAPTOR_TEST( "aa", 1 );
+  RAPTOR_COMPILE( raptor, "a:" );
+  RAPTOR_TEST( "a:", 1 );
+
+  wide[0] = '\0';
+  for( int i = 0; i < 200; i++ ) sprintf( wide + strlen( wide ), "f%d,", i );
+  RAPTOR_COMPILE( raptor, "<[^,]+>" );
+  initCatchCtx( &ctx, &arena );
+  RAPTOR_LEN_TEST( wide, strlen( wide ), 200 );
+  total++;
+  if( totCatchCtx( &ctx ) != 200 || overCatchCtx( &ctx ) || strcmp( cpyCatchCtx( &ctx, str, 200 ), "f199" ) != 0 ||
+      arena.used != 201 * sizeof( struct CAPTURE ) ){
+    printf( "%s:%d Error on RAPTOR arena >%s< %d\n", __FILE__, __LINE__, str, totCatchCtx( &ctx ) );
+    errs++;
+  }
+  initCatchCtx( &ctx, &small );
+  RAPTOR_LEN_TEST( wide, strlen( wide ), 200 );
+  total++;
+  if( totCatchCtx( &ctx ) != 10 || !overCatchCtx( &ctx ) || strcmp( cpyCatchCtx( &ctx, str, 10 ), "f9" ) != 0 ){
+    printf( "%s:%d Error on RAPTOR small arena >%s< %d\n", __FILE__, __LINE__, str, totCatchCtx( &ctx ) );
+    errs++;
+  }
+  initCatchCtx( &ctx, NULL );
+  free( arena.mem );
+
+  wide[0] = '\0';
+  for( int i = 0; i < 300; i++ ) sprintf( wide + strlen( wide ), "%sc%d", i ? "|" : "", i );
+  total++;
+  if( RAPTOR_COMPILE( raptor, wide ) != 2 * 300 + 3 ){
+    printf( "%s:%d Error on RAPTOR table size\n", __FILE__, __LINE__ );
+    errs++;
+  }
+  RAPTOR_TEST( "c0 c29 c299 x", 3 );
+  NTEST( "c0 c29 c299 x", wide, 3 );
+  for( int i = 300; i < 2500; i++ ) sprintf( wide + strlen( wide ), "|c%d", i );
+  NTEST( "c0 c29 c2499 x", wide, 3 );
+
+  for( int i = 0; i < 600; i++ ) wide[ i ] = 'a' + i % 26;
+  wide[ 600 ] = '\0';
+  total++;
+  if( RAPTOR_COMPILE( raptor, wide ) != 4 ){
+    printf( "%s:%d Error on RAPTOR literal chunks\n", __FILE__, __LINE__ );
+    errs++;
+  }
+  RAPTOR_TEST( wide, 1 );
+  wide[ 599 ] = '-';
+  RAPTOR_TEST( wide, 0 );
+  RAPTOR_COMPILE( raptor, "#*<x+>-<[B-D]+>" );
+  RAPTOR_PUT_TEST( "-xXxX-bCd-", "#1|#2", "xXxX|bCd" );
+  RAPTOR_COMPILE( raptor, "<[a-c]>@1{2}" );
+  RAPTOR_PUT_TEST( "abbbcc", "#1", "b" );
+
+  RAPTOR_COMPILE( raptor, "<(x(y|z))+>" );
+  initStackCtx( &ctx, track, 4 );
+  RAPTOR_PUT_TEST( "-xyxzx-", "#1", "xyxzx" );
+  initStackCtx( &ctx, track, 2 );
+  RAPTOR_PUT_TEST( "-xzxyx-", "#1", "xzxyx" );
+  RAPTOR_SAME_TEST( "-xyxzxyxz- xz xyx", "<(x(y|z))+>", "#1|#2|#3" );
+  RAPTOR_SAME_TEST( "-xyxzx-", "<(<x>(y|<z>))+>", "#1|#2|#3|#4|#5|#6|#7" );
+  initStackCtx( &ctx, NULL, 0 );
+
+  RAPTOR_COMPILE( raptor, "[a-z]+-[a-z]+|:d+::" );
+  RAPTOR_TEST( "dolor-sit 12:30 x-y", 3 );
+  initCacheCtx( &ctx, cache, sizeof cache );
+  RAPTOR_TEST( "dolor-sit 12:30 x-y", 3 );
+  initCacheCtx( &ctx, cache, 256 );
+  RAPTOR_TEST( "dolor-sit 12:30 x-y 1: a-b-c 22:", 6 );
+  RAPTOR_SAME_TEST( "ab-cd 1:2 33: zz-yy-xx 4::", "[a-z]+-[a-z]+|:d+::", "" );
+  initCacheCtx( &ctx, cache, sizeof cache );
+  RAPTOR_COMPILE( raptor, "a+b|a" );
+  RAPTOR_TEST( "aaa", 3 );
+  RAPTOR_COMPILE( raptor, "ab|a+c" );
+  RAPTOR_TEST( "aaac", 1 );
+  RAPTOR_COMPILE( raptor, "#$ab+" );
+  RAPTOR_TEST( "abb ab abbb", 1 );
+  RAPTOR_TEST( "abb ab abbbc", 0 );
+  RAPTOR_COMPILE( raptor, "#^:a+-:a" );
+  RAPTOR_TEST( "x-ab-cd-e", 1 );
+  RAPTOR_SAME_TEST( "ab-c x-y abc-d-e", "#^:a+-:a", "" );
+  RAPTOR_SAME_TEST( "ab-c x-y abc-d-e", ":a+-:a", "" );
+  RAPTOR_SAME_TEST( "aab ab b", "(a)b", "" );
+  RAPTOR_COMPILE( raptor, "<a+><b>|<a>c" );
+  RAPTOR_PUT_TEST( "aac ab aab", "#1#2#3#4#5", "aabaab" );
+  RAPTOR_FIND_TEST( "aac ab aab", "#0#1#2", "aca|abab|aabaab|" );
+  RAPTOR_SAME_TEST( "aac ab aab ac", "<a+><b>|<a>c", "#1|#2|#3|#4|#5|#6|#7" );
+  RAPTOR_COMPILE( raptor, "<k><:d+>" );
+  RAPTOR_PUT_TEST( "k12 k3 k", "#1#2#3#4", "k12k3" );
+  RAPTOR_COMPILE( raptor, "#$<b><c>d" );
+  RAPTOR_PUT_TEST( "abcd bcd", "#1#2", "bc" );
+  RAPTOR_COMPILE( raptor, "<[a-z]+>:s<:d+>" );
+  RAPTOR_PUT_TEST( "lorem ipsum 12 x dolor 7 sit 5", "#1#2#3#4#5#6", "ipsum12dolor7sit5" );
+  RAPTOR_COMPILE( raptor, "<(:a)+>=<:d+>" );
+  RAPTOR_PUT_TEST( "ab cd=12 x=3 =4 y=", "#1#2#3#4#5#6", "cd12x3" );
+  RAPTOR_SAME_TEST( "ab cd=12 x=3 =4 y= zz=99", "<(:a)+>=<:d+>", "#1|#2|#3|#4|#5|#6" );
+  RAPTOR_COMPILE( raptor, "(<a+>|<b>)+;" );
+  RAPTOR_PUT_TEST( "aab,ab;b", "#1#2#3#4", "ab" );
+  RAPTOR_SAME_TEST( "aa a aaa", "<a>@1", "#1|#2|#3" );
+  RAPTOR_COMPILE( raptor, "#*ant|bee|cat|dog|eel|<fox>:d|gnu|hen+" );
+  RAPTOR_PUT_TEST( "a BEE, FOX7 and hennn dog", "#1", "FOX" );
+  RAPTOR_TEST( "a BEE, FOX7 and hennn dog", 4 );
+  RAPTOR_SAME_TEST( "a BEE, FOX7 and hennn dog fox eel", "#*ant|bee|cat|dog|eel|<fox>:d|gnu|hen+", "#1|#2" );
+  RAPTOR_COMPILE( raptor, "(https?|ftp):://<[^:s/]+>" );
+  RAPTOR_PUT_TEST( "see http://a.org, ftp:/b https://c.net/x and ftp://d", "#1|#2|#3", "a.org,|c.net|d" );
+  RAPTOR_SAME_TEST( "://x see http://a.org, ftp:/b https://c.net/x and ftp://d", "(https?|ftp):://<[^:s/]+>", "#1|#2|#3|#4" );
+  RAPTOR_COMPILE( raptor, "<:w+>:@<:w+>" );
+  RAPTOR_TEST( "a@ x@y @b zz@top", 2 );
+  RAPTOR_COMPILE( raptor, "x?(ab){2}cdef+g" );
+  RAPTOR_TEST( "ababcdeg abcdefg xababcdeffg cdefg", 1 );
+  RAPTOR_COMPILE( raptor, "ant|bee|cat|dog|eel|fox|gnu|h?en" );
+  RAPTOR_TEST( "a bee, en", 2 );
+  RAPTOR_SAME_TEST( "a bee, en hen n eel", "ant|bee|cat|dog|eel|fox|gnu|h?en", "" );
+  RAPTOR_COMPILE( raptor, "#$<:w+>:.txt" );
+  RAPTOR_PUT_TEST( "a.txt b.txt notes.txt", "#1", "notes" );
+  RAPTOR_SAME_TEST( "a.txt b.txt notes.txt", "#$<:w+>:.txt", "#1" );
+  RAPTOR_SAME_TEST( "a.txt b.txt notes.txt x", "#$<:w+>:.txt", "#1" );
+  RAPTOR_COMPILE( raptor, "#$<:d+>x:w*" );
+  RAPTOR_PUT_TEST( "12x 345xab", "#1", "345" );
+  RAPTOR_COMPILE( raptor, "#$[^a]" );
+  RAPTOR_TEST( "bc", 1 );
+  RAPTOR_TEST( "ba", 0 );
+  RAPTOR_COMPILE( raptor, "#$jpg|png" );
+  RAPTOR_TEST( "a.png x.jpg", 1 );
+  RAPTOR_TEST( "a.png x.gif", 0 );
+  RAPTOR_SAME_TEST( "lorem ipsum dolor <a.b> caf\xC3\xA9 <c\xC3\xA9> amet consectetur <d.e>", "<<[^>]+>>", "#1|#2|#3" );
+  RAPTOR_SAME_TEST( "lorem ipsum dolor x.y caf\xC3\xA9 x\xC3\xA9y amet consectetur xyy", "x.y", "" );
+  RAPTOR_COMPILE( raptor, "=<[^ ;]+>;" );
+  RAPTOR_FIND_TEST( "lorem ipsum dolor =a.b; caf\xC3\xA9 =\xC3\xA9\xC3\xA9; amet consectetur =d;", "#1",
+                    "=a.b;a.b|=\xC3\xA9\xC3\xA9;\xC3\xA9\xC3\xA9|=d;d|" );
+#ifdef REGEXP4_BOTH
+  raptorArena.used = 0;
+  compileRaptorUtf8( &raptor, &raptorArena, "<.>x", 4 );
+  RAPTOR_PUT_TEST( "\xc3\xb1x", "#1", "\xc3\xb1" );
+  RAPTOR_COMPILE( raptor, "<.>x" );
+  RAPTOR_PUT_TEST( "\xc3\xb1x", "#1", "\xb1" );
+#endif
+
+  total++;
+  if( validUtf8( "a\xc3\xb1\xe2\x96\xb2\xf0\x9f\xa6\x96", 10 ) != 10 || validUtf8( "ab\xc3", 3 ) != 2 ||
+      validUtf8( "abcdefgh\xed\xa0\x80", 11 ) != 8 || validUtf8( "\xc0\xaf", 2 ) != 0 || validUtf8( "", 0 ) != 0 ){
+    printf( "%s:%d Error on UTF8 valid\n", __FILE__, __LINE__ );
+    errs++;
+  }
+  initTrustCtx( &ctx, 1 );
+  RAPTOR_COMPILE( raptor, "<.+>" );
+  RAPTOR_PUT_TEST( "a\xc3\xb1", "#1", "a\xc3\xb1" );
+#ifdef REGEXP4_BOTH
+  raptorArena.used = 0;
+  compileRaptorUtf8( &raptor, &raptorArena, "<.>", 3 );
+  RAPTOR_PUT_TEST( "\xc3x", "#1", "\xc3x" );
+  initTrustCtx( &ctx, 0 );
+  RAPTOR_PUT_TEST( "\xc3x", "#1", "\xc3" );
+#endif
+  initTrustCtx( &ctx, 0 );
+  initCacheCtx( &ctx, NULL, 0 );
+
+  RAPTOR_COMPILE( raptor, "<:a>:d+" );
+  RAPTOR_FIND_TEST( "a1 b22 c333 d", "=#1", "a1=a|b22=b|c333=c|" );
+  RAPTOR_FIND_TEST( "a b c", "=#1", "" );
+  RAPTOR_COMPILE( raptor, "#*ant|bee|cat|dog|eel|<fox>:d|gnu|hen+" );
+  RAPTOR_FIND_TEST( "a BEE, FOX7 and hennn dog", "#0", "BEE|FOX7|hennn|dog|" );
+  RAPTOR_COMPILE( raptor, "(https?|ftp):://<[^:s/]+>" );
+  RAPTOR_FIND_TEST( "see http://a.org, ftp:/b https://c.net/x and ftp://d", "", "http://a.org,|https://c.net|ftp://d|" );
+  RAPTOR_COMPILE( raptor, "<x><y>|<z>" );
+  RAPTOR_FIND_TEST( "xy z xy z xy z xy z xy z xy z xy z", "#0#1#2#3", "xyxy|zz|xyxy|zz|xyxy|zz|xyxy|zz|xyxy|zz|xyxy|zz|xyxy|zz|" );
+  RAPTOR_COMPILE( raptor, "x*" );
+  RAPTOR_FIND_TEST( "-xx-", "", "|xx||" );
+  RAPTOR_COMPILE( raptor, "#~x+" );
+  RAPTOR_FIND_TEST( "-xx-", "", "xx|x|" );
+  RAPTOR_COMPILE( raptor, "#?:d" );
+  RAPTOR_FIND_TEST( "a1 2 3", "", "1|" );
+  RAPTOR_COMPILE( raptor, "#^:d" );
+  RAPTOR_FIND_TEST( "1 2 3", "", "1|" );
+  RAPTOR_COMPILE( raptor, "#$:d" );
+  RAPTOR_FIND_TEST( "1 2 3", "", "3|" );
+
+  RAPTOR_COMPILE( raptor, "<:a+>" );
+  RAPTOR_COMPILE( other , "<:d+>" );
+  matchRaptor( &ctxOther, &other, "1 22 333", 8 );
+  RAPTOR_PUT_TEST( "a bb", "#2#1", "bba" );
+
+  const char  *packRe[] = { ":d+", "#^b", "#*RAPTOR", "qq", "#$a+", "zz", "(r|b)<a>" };
+  struct PACK  pack;
+  int          at[ 7 ];
+  total++;
+  if( compilePack( &pack, &raptorArena, packRe, NULL, 7 ) != 7 || matchPack( &ctx, &pack, "b 12 raptor aa", 14, at ) != 5 ||
+      at[0] != 2 || at[1] != 0 || at[2] != 5 || at[3] != -1 || at[4] != 12 || at[5] != -1 || at[6] != 5 ){
+    printf( "%s:%d Error on PACK\n", __FILE__, __LINE__ );
+    errs++;
+  }
+  packRe[ 3 ] = "";
+  total++;
+  if( compilePack( &pack, &raptorArena, packRe, NULL, 7 ) != -1 || pack.count != 3 || matchPack( &ctx, &pack, "b 12 raptor aa", 14, at ) != 3 ){
+    printf( "%s:%d Error on PACK failure %d\n", __FILE__, __LINE__, pack.count );
+    errs++;
+  }
+  struct ARENA tiny = { found, 64, 0, NULL };
+  total++;
+  if( compileRaptor( &raptor, &tiny, "<:d+>", 5 ) != -1 || raptor.index || raptor.table || matchRaptor( &ctx, &raptor, "12", 2 ) ){
+    printf( "%s:%d Error on RAPTOR failure\n", __FILE__, __LINE__ );
+    errs++;
+  }
+  total++;
+  if( sizeRaptor( "a{70000}", 8 ) != -1 || compileRaptor( &raptor, &raptorArena, "(ab){2,65535}", 13 ) != -1 || raptor.index ||
+      regexp4( "aaa", "#^a{3,70000}" ) || regexp4( "aaa", "#^a{99999999999}" ) || regexp4( "aaa", "#^a{3,65534}" ) != 1 ){
+    printf( "%s:%d Error on RAPTOR loops\n", __FILE__, __LINE__ );
+    errs++;
+  }
+
+  free( raptorArena.mem );
+  free( otherArena.mem );
+  total++;
+  if( totCatchCtx( &ctxOther ) != 3 || strcmp( putCatchCtx( &ctxOther, str, "#3#2#1" ), "333221" ) != 0 ){
+    printf( "%s:%d Error on RAPTOR context >%s<\n", __FILE__, __LINE__, str );
+    errs++;
+  }
+
 
   printf( "TEST %d *** ERRS %d\n\n", total, errs );
   return !errs;
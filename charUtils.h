@@ -14,59 +14,157 @@ static int strLen( const char *str ){
     if( *i == 0 ) return i - str;
 }
 
-static void strCpy( char *dest, const char *src ){
- while( (*dest++ = *src++) );
+static int cmpChrCommunist( const char a, const char b){
+  return toLower(a) == toLower(b);
 }
 
-static void strnCpy( char *dest, const char *src, int n ){
-  while( n > 0 && (*dest++ = *src++) ) n--;
+static int memEqlCommunist( const char *s, const char *t, int n ){
+  for( ; n > 0; s++, t++, n-- )
+    if( !cmpChrCommunist( *s, *t ) ) return 0;
 
-  *dest = '\0';
+  return 1;
 }
 
-static const char * strnChr( const char *str, const int chr, const int n ){
-  for( int i = 0; i < n && str[ i ]; i++ )
-    if( str[ i ] == chr ) return str + i;
+static int memEql( const char *s, const char *t, int n ){
+  for( ; n > 0; s++, t++, n-- )
+    if( *s != *t ) return 0;
 
-  return 0;
+  return 1;
 }
 
-static int strnEql( const char *s, const char *t, int n ){
-  for( ; *s == *t; s++, t++ )
-    if( *s == '\0' || --n <= 0 ) return 1;
+#define ONES  0x0101010101010101ULL
+#define HIGHS 0x8080808080808080ULL
 
-  return 0;
+static unsigned long long loadWord( const char *str ){
+  const unsigned char *s = (const unsigned char *)str;
+  return (unsigned long long)s[0]       | (unsigned long long)s[1] <<  8 |
+         (unsigned long long)s[2] << 16 | (unsigned long long)s[3] << 24 |
+         (unsigned long long)s[4] << 32 | (unsigned long long)s[5] << 40 |
+         (unsigned long long)s[6] << 48 | (unsigned long long)s[7] << 56;
 }
 
-static int cmpChrCommunist( const char a, const char b){
-  return toLower(a) == toLower(b);
+static int hasZeroByte( const unsigned long long w ){
+  return ((w - ONES) & ~w & HIGHS) != 0;
 }
 
-static const char * strnChrCommunist( const char *str, const int chr, const int n ){
-  for( int i = 0; i < n && str[ i ]; i++ )
-    if( cmpChrCommunist( str[i], chr ) ) return str + i;
+static const char * memChr( const char *str, const int chr, const int n ){
+  const unsigned long long mask = ONES * (unsigned char)chr;
+  int i = 0;
+
+  while( i + 8 <= n && !hasZeroByte( loadWord( str + i ) ^ mask ) ) i += 8;
+
+  for( ; i < n; i++ )
+    if( str[ i ] == (char)chr ) return str + i;
 
   return 0;
 }
 
-static int strnEqlCommunist( const char *s, const char *t, int n ){
-  for( ; cmpChrCommunist( *s, *t ); s++, t++ )
-    if( *s == '\0' || --n <= 0 ) return 1;
+static const char * memStr( const char *str, const int n, const char *sub, const int m ){
+  if( m <= 1 ) return m ? memChr( str, *sub, n ) : str;
+
+  const unsigned long long first = ONES * (unsigned char)sub[0], last = ONES * (unsigned char)sub[m - 1];
+  int i = 0;
+
+  for( ; i + m - 1 + 8 <= n; i += 8 )
+    if( hasZeroByte( (loadWord( str + i ) ^ first) | (loadWord( str + i + m - 1 ) ^ last) ) )
+      for( int j = i; j < i + 8; j++ )
+        if( memEql( str + j, sub, m ) ) return str + j;
+
+  for( ; i + m <= n; i++ )
+    if( memEql( str + i, sub, m ) ) return str + i;
 
   return 0;
 }
 
-static int aToi( const char *str ){
+static const char * memSkip( const char *str, const int n, const char *sub, const int m, const unsigned char *skip ){
+  for( int i = m - 1; i < n; i += skip[ (unsigned char)str[ i ] ] )
+    if( str[ i ] == sub[ m - 1 ] && memEql( str + i - m + 1, sub, m - 1 ) ) return str + i - m + 1;
+
+  return 0;
+}
+
+static int spanChr( const char *str, int i, const int n, const int chr ){
+  const unsigned long long mask = ONES * (unsigned char)chr;
+
+  while( i + 8 <= n && loadWord( str + i ) == mask ) i += 8;
+  while( i < n && str[ i ] == (char)chr ) i++;
+
+  return i;
+}
+
+static int spanAscii( const char *str, int i, const int n ){
+  while( i + 8 <= n && !(loadWord( str + i ) & HIGHS) ) i += 8;
+  while( i < n && !(str[ i ] & 0x80) ) i++;
+
+  return i;
+}
+
+static int spanUtf8( const char *str, int i, const int n ){
+  for( int width; (i = spanAscii( str, i, n )) < n; i += width ){
+    const unsigned char c = str[ i ], d = i + 1 < n ? str[ i + 1 ] : 0;
+    width = c < 0xC2 ? 0 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : c < 0xF5 ? 4 : 0;
+
+    if( width == 0 || i + width > n ) return i;
+    if( (c == 0xE0 && d < 0xA0) || (c == 0xED && d > 0x9F) || (c == 0xF0 && d < 0x90) || (c == 0xF4 && d > 0x8F) ) return i;
+    for( int k = 1; k < width; k++ )
+      if( (str[ i + k ] & 0xC0) != 0x80 ) return i;
+  }
+
+  return i;
+}
+
+static int spanChrCommunist( const char *str, int i, const int n, const int chr ){
+  while( i < n && cmpChrCommunist( str[ i ], chr ) ) i++;
+
+  return i;
+}
+
+static int  getBit( const unsigned char *bits, const unsigned char c ){ return bits[ c >> 3 ] & (1 << (c & 7)); }
+static void setBit(       unsigned char *bits, const unsigned char c ){ bits[ c >> 3 ] |= 1 << (c & 7); }
+static void setBits(      unsigned char *bits, const int from, const int to ){ for( int i = from >> 3; i < to >> 3; i++ ) bits[ i ] = 0xFF; }
+
+static int findRange( const unsigned long long *range, int n, const unsigned long long key ){
+  if( n == 0 ) return 0;
+
+  for( int half; n > 1; n -= half ){
+    half  = n / 2;
+    range = range[ 2 * half ] <= key ? range + 2 * half : range;
+  }
+
+  return range[ 0 ] <= key && key <= range[ 1 ];
+}
+
+static int scanBits( const unsigned char *bits, const char *str, int i, const int n ){
+  for( ; i + 4 <= n; i += 4 )
+    if( getBit( bits, str[ i ] ) | getBit( bits, str[ i + 1 ] ) | getBit( bits, str[ i + 2 ] ) | getBit( bits, str[ i + 3 ] ) )
+      break;
+
+  while( i < n && !getBit( bits, str[ i ] ) ) i++;
+
+  return i;
+}
+
+static int spanBits( const unsigned char *bits, const char *str, int i, const int n ){
+  for( ; i + 4 <= n; i += 4 )
+    if( !(getBit( bits, str[ i ] ) && getBit( bits, str[ i + 1 ] ) && getBit( bits, str[ i + 2 ] ) && getBit( bits, str[ i + 3 ] )) )
+      break;
+
+  while( i < n && getBit( bits, str[ i ] ) ) i++;
+
+  return i;
+}
+
+static int aToi( const char *str, int n ){
   int uNumber = 0;
-  while( isDigit( *str ) )
+  while( n-- > 0 && isDigit( *str ) )
     uNumber = 10 * uNumber + ( *str++ - '0' );
 
   return uNumber;
 }
 
-static int countCharDigits( const char *str ){
+static int countCharDigits( const char *str, const int n ){
   for( int digits = 0; ; digits++ )
-    if( isDigit( *str++ ) == 0 ) return digits;
+    if( digits == n || isDigit( *str++ ) == 0 ) return digits;
 }
 
 #endif
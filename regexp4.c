@@ -0,0 +1,49 @@
+#include "regexp4.h"
+
+#ifndef REGEXP4_BOTH
+#error "build regexp4.c, regexp4_ascii.c and regexp4_utf8.c with -DREGEXP4_BOTH"
+#endif
+
+#include "regexp4_ctx.h"
+
+int matchRaptorAscii( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len );
+int matchRaptorUtf8 ( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len );
+int findRaptorAscii ( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len, int *offset );
+int findRaptorUtf8  ( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len, int *offset );
+int matchPackAscii  ( struct CONTEXT *ctx, const struct PACK *pack, const char *txt, const int len, int *at );
+int matchPackUtf8   ( struct CONTEXT *ctx, const struct PACK *pack, const char *txt, const int len, int *at );
+int shotRaptorAscii ( struct CONTEXT *ctx, const char *txt, const char *re );
+int shotRaptorUtf8  ( struct CONTEXT *ctx, const char *txt, const char *re );
+
+int validUtf8Utf8( const char *txt, const int len );
+
+int sizeRaptor( const char *re, const int len ){ return sizeRaptorAscii( re, len ); }
+int compileRaptor( struct RAPTOR *raptor, struct ARENA *arena, const char *re, const int len ){ return compileRaptorAscii( raptor, arena, re, len ); }
+int sizePack( const char **re, const int *lens, const int count ){ return sizePackAscii( re, lens, count ); }
+int compilePack( struct PACK *pack, struct ARENA *arena, const char **re, const int *lens, const int count ){ return compilePackAscii( pack, arena, re, lens, count ); }
+
+int matchRaptor( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len ){
+  return raptor->utf8 ? matchRaptorUtf8( ctx, raptor, txt, len ) : matchRaptorAscii( ctx, raptor, txt, len );
+}
+
+int findRaptor( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len, int *offset ){
+  return raptor->utf8 ? findRaptorUtf8( ctx, raptor, txt, len, offset ) : findRaptorAscii( ctx, raptor, txt, len, offset );
+}
+
+int matchPack( struct CONTEXT *ctx, const struct PACK *pack, const char *txt, const int len, int *at ){
+  return pack->count && pack->raptor->utf8 ? matchPackUtf8( ctx, pack, txt, len, at ) : matchPackAscii( ctx, pack, txt, len, at );
+}
+
+int validUtf8( const char *txt, const int len ){ return validUtf8Utf8( txt, len ); }
+
+static struct CONTEXT context;
+
+int regexp4    ( const char *txt, const char *re ){ return shotRaptorAscii( &context, txt, re ); }
+int regexp4Utf8( const char *txt, const char *re ){ return shotRaptorUtf8 ( &context, txt, re ); }
+
+int          totCatch(){ return totCatchCtx( &context ); }
+const char * gpsCatch( const int index ){ return gpsCatchCtx( &context, index ); }
+int          lenCatch( const int index ){ return lenCatchCtx( &context, index ); }
+char *       cpyCatch( char *str, const int index ){ return cpyCatchCtx( &context, str, index ); }
+char *       rplCatch( char *newStr, const char *rplStr, const int id ){ return rplCatchCtx( &context, newStr, rplStr, id ); }
+char *       putCatch( char *newStr, const char *putStr ){ return putCatchCtx( &context, newStr, putStr ); }
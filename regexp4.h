@@ -19,8 +19,144 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  ************************************************************************/
 
+#define MAX_CATCHS         16
+#define MAX_LOOPS       65535
+
+enum COMMAND { COM_PATH_INI, COM_PATH_ELE, COM_PATH_END, COM_GROUP_INI, COM_GROUP_END,
+               COM_HOOK_INI, COM_HOOK_END, COM_SET_INI, COM_SET_END,
+               COM_BACKREF, COM_META, COM_RANGEAB, COM_UTF8, COM_POINT, COM_SIMPLE, COM_END };
+
+enum RUN { RUN_MATCH, RUN_SET, RUN_NOT, RUN_BYTE, RUN_POINT, RUN_TEXT };
+
+struct TABLE {
+  unsigned char  command;
+  unsigned char  run;
+  unsigned char  mods;
+  unsigned char  chr;
+  unsigned short loopsMin;
+  unsigned short loopsMax;
+  int            close;
+  int            arg;
+};
+
+struct ARENA {
+  char *mem;
+  int   size;
+  int   used;
+  int (*grow)( struct ARENA *arena, const int size );
+};
+
+struct ENGINE;
+
+struct RAPTOR {
+  struct TABLE  *table;
+  int            index;
+  int            mods;
+  int            utf8;
+  int            depth;
+  struct ENGINE *engine;
+};
+
+struct PACK {
+  struct RAPTOR *raptor;
+  int            count;
+  int            depth;
+  unsigned char  first[ 32 ];
+  int            anyFirst;
+  unsigned      *bucket;
+  int            words;
+};
+
+struct CAPTURE {
+  const char *ptr;
+  int   len;
+  int   id;
+};
+
+struct CATch {
+  struct CAPTURE *slot;
+  int   max;
+  int   idx;
+  int   index;
+  int   over;
+  int   mute;
+  int   base;
+  struct ARENA   *arena;
+  struct CAPTURE  own[ MAX_CATCHS ];
+};
+
+struct TRACK {
+  int   index;
+  int   count;
+  int   pos;
+  int   cIndex;
+  int   cIdx;
+};
+
+struct TEXT {
+  const char *ptr;
+  int   pos;
+  int   len;
+};
+
+struct CONTEXT {
+  const struct TABLE *table;
+  const unsigned char (*sets)[ 32 ];
+  const unsigned long long *ranges;
+  const char         *pool;
+  struct CATch        Catch;
+  struct TEXT         text;
+  struct TRACK       *stack;
+  int                 stackMax;
+  int                *cache;
+  int                 cacheSize;
+  int                 trusted;
+};
+
+int  sizeRaptor   ( const char *re, const int len );
+int  compileRaptor( struct RAPTOR *raptor, struct ARENA *arena, const char *re, const int len );
+int  matchRaptor  ( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len );
+int  findRaptor   ( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len, int *offset );
+
+int  sizePack     ( const char **re, const int *lens, const int count );
+int  compilePack  ( struct PACK *pack, struct ARENA *arena, const char **re, const int *lens, const int count );
+int  matchPack    ( struct CONTEXT *ctx, const struct PACK *pack, const char *txt, const int len, int *at );
+
+const
+char *gpsMatchCtx( const struct CONTEXT *ctx );
+int   lenMatchCtx( const struct CONTEXT *ctx );
+
+void  initCatchCtx( struct CONTEXT *ctx, struct ARENA *arena );
+int   overCatchCtx( const struct CONTEXT *ctx );
+void  initStackCtx( struct CONTEXT *ctx, struct TRACK *stack, const int max );
+void  initCacheCtx( struct CONTEXT *ctx, char *cache, const int size );
+void  initTrustCtx( struct CONTEXT *ctx, const int trusted );
+int   validUtf8   ( const char *txt, const int len );
+
+const
+char *gpsCatchCtx( const struct CONTEXT *ctx, const int index );
+int   totCatchCtx( const struct CONTEXT *ctx );
+int   lenCatchCtx( const struct CONTEXT *ctx, const int index );
+char *cpyCatchCtx( const struct CONTEXT *ctx, char *str, const int index );
+char *rplCatchCtx( const struct CONTEXT *ctx, char *newStr, const char *rplStr, const int id );
+char *putCatchCtx( const struct CONTEXT *ctx, char *newStr, const char *putStr );
+
 int  regexp4( const char *txt, const char *re );
 
+#ifdef REGEXP4_BOTH
+int  sizeRaptorAscii   ( const char *re, const int len );
+int  compileRaptorAscii( struct RAPTOR *raptor, struct ARENA *arena, const char *re, const int len );
+int  sizeRaptorUtf8    ( const char *re, const int len );
+int  compileRaptorUtf8 ( struct RAPTOR *raptor, struct ARENA *arena, const char *re, const int len );
+
+int  sizePackAscii     ( const char **re, const int *lens, const int count );
+int  compilePackAscii  ( struct PACK *pack, struct ARENA *arena, const char **re, const int *lens, const int count );
+int  sizePackUtf8      ( const char **re, const int *lens, const int count );
+int  compilePackUtf8   ( struct PACK *pack, struct ARENA *arena, const char **re, const int *lens, const int count );
+
+int  regexp4Utf8( const char *txt, const char *re );
+#endif
+
 const
 char *gpsCatch( const int index );
 int   totCatch();
@@ -0,0 +1,2326 @@
+#ifdef REGEXP4_BOTH
+#define sizeRaptor    ENCODED( sizeRaptor    )
+#define compileRaptor ENCODED( compileRaptor )
+#define matchRaptor   ENCODED( matchRaptor   )
+#define findRaptor    ENCODED( findRaptor    )
+#define sizePack      ENCODED( sizePack      )
+#define compilePack   ENCODED( compilePack   )
+#define matchPack     ENCODED( matchPack     )
+#define validUtf8     ENCODED( validUtf8     )
+#define shotRaptor    ENCODED( shotRaptor    )
+#endif
+
+#include <stdlib.h>
+
+#include "regexp4.h"
+#include "charUtils.h"
+#include "unicodeTables.h"
+
+#define TRUE                1
+#define FALSE               0
+#define NIL                 0
+#define INF        1073741824 // 2^30
+
+#define MOD_ALPHA           1
+#define MOD_OMEGA           2
+#define MOD_LONLEY          4
+#define MOD_FwrByChar       8
+#define MOD_COMMUNISM      16
+#define MOD_NEGATIVE      128
+
+#define MAX_LITERAL       255
+#define DFA_POSITIONS     256
+#define DFA_DEAD           -1
+#define DFA_DONE           -2
+#define DFA_UNSEEN         -3
+#define DFA_PENDING         0
+#define DFA_COUNT           1
+#define DFA_STEPS           2
+#define PIKE_STATE          0
+#define PIKE_START          1
+#define PIKE_PATH           2
+#define PIKE_HOOKS          3
+#define PIKE_REC( hooks )  (PIKE_HOOKS + 2 * (hooks))
+#define TRIE_NODE           6
+#define TRIE_CHR            0
+#define TRIE_CHILD          1
+#define TRIE_NEXT           2
+#define TRIE_FAIL           3
+#define TRIE_DEPTH          4
+#define TRIE_QUEUE          5
+#define TRIE_AT( trie, node ) ((trie) + 256 + (node) * TRIE_NODE)
+#define TRIE_PATHS          8
+#define INNER_FAR  0x40000000
+#define INNER_SKIP          4
+#define BACK_STATES        64
+#define BACK_SIZE         320
+#define SHOT_SIZE       65536
+#define ASCII_RUN          16
+#define ASCII_SPAN        256
+#define WIDE_KEY           (0x80ULL << 56)
+
+#if RAPTOR_UTF8
+#define INNER_METAS        "aAdDwWsS&"
+#define MAX_WIDTH           8
+#define SET_CHARS         128
+#else
+#define INNER_METAS        "aAdDwWsS"
+#define MAX_WIDTH           1
+#define SET_CHARS         256
+#endif
+
+enum RE_TYPE { PATH, GROUP, HOOK, SET, BACKREF, META, RANGEAB, UTF8, POINT, SIMPLE };
+
+struct RE {
+  const    char    *ptr;
+  unsigned int      len, index;
+  enum     RE_TYPE  type;
+  unsigned char     mods;
+  unsigned int      loopsMin, loopsMax;
+};
+
+struct DFA {
+  int       *mem;
+  int        size, used, rec, classes, flushes;
+  const int *starts;
+  int        nStarts;
+};
+
+struct ENGINE {
+  const char    *prefix;
+  int            prefixLen;
+  unsigned char  first[ 32 ];
+  int            anyFirst;
+  unsigned char (*sets)[ 32 ];
+  int            setIndex;
+  int            setMax;
+  unsigned long long *ranges;
+  int            rangeLen;
+  char          *pool;
+  int            poolLen;
+  int            loopsOver;
+  int            probe;
+  unsigned char  classes[ 256 ];
+  int            classCount;
+  int            positions;
+  int            hooks;
+  int            wide;
+  int           *trie;
+  int            nodes;
+  int            trieMax;
+  int            trieFold;
+  char           inner[ 32 ];
+  int            innerLen;
+  int            innerMin;
+  int            innerMax;
+  unsigned char  skip[ 256 ];
+  int            reach;
+  unsigned long long *back;
+  int            backStates;
+  int            backHead;
+};
+
+static int  genTable    ( struct RAPTOR *raptor, const char *re, const int len );
+static void tableAppend ( struct RAPTOR *raptor, struct RE *rexp, enum COMMAND command );
+static void tableClose  ( struct RAPTOR *raptor, const int index );
+
+static void genPaths    ( struct RAPTOR *raptor, struct RE  rexp );
+static void genTracks   ( struct RAPTOR *raptor, struct RE *rexp );
+static void genSet      ( struct RAPTOR *raptor, struct RE *rexp );
+static void rangeAppend ( struct RAPTOR *raptor, const int head, const struct RE *rexp );
+static void rangePair   ( struct RAPTOR *raptor, const int head, const unsigned long long lo, const unsigned long long hi );
+static void rangeMerge  ( unsigned long long *range );
+static void genPrefix   ( struct RAPTOR *raptor );
+static void genFirst    ( struct RAPTOR *raptor );
+static void genTrie     ( struct RAPTOR *raptor );
+static void genInner    ( struct RAPTOR *raptor );
+static void genBack     ( struct RAPTOR *raptor );
+static void genSets     ( struct RAPTOR *raptor );
+static void genRuns     ( struct RAPTOR *raptor );
+static void genDepth    ( struct RAPTOR *raptor );
+static void genDfa      ( struct RAPTOR *raptor );
+static int  isPath      ( struct RE *rexp );
+static int  sizeTrie    ( const struct RAPTOR *raptor );
+static int  sizeBack    ( const struct RAPTOR *raptor );
+static int  wideSet     ( const struct RAPTOR *raptor, const int index );
+static int  countPaths  ( struct RE rexp );
+static int  tracker     ( struct RE *rexp, struct RE *track );
+static int  trackerSet  ( struct RE *rexp, struct RE *track );
+
+static void cutSimple   ( struct RE *rexp, struct RE *track );
+static int  cutByType   ( struct RE *rexp, struct RE *track, const int type );
+static void cutByLen    ( struct RE *rexp, struct RE *track, const int len, const int type );
+static void cutRexp     ( struct RE *rexp, const  int len );
+
+static void getMods     ( struct RE *rexp, struct RE *track );
+static void getLoops    ( struct RE *rexp, struct RE *track );
+
+static int  walkSet     ( const char *str, const  int len );
+static int  walkMeta    ( const char *str, const  int len );
+
+static const unsigned char xooooooo = 0x80; // instead `isUTF8( c )` use `c & xooooooo`
+static const unsigned char xxoooooo = 0xC0;
+
+static int utf8meter( const char *str, const int len ){
+  unsigned char i, utfOrNo;
+
+  if( len <= 0 ) return 0;
+
+  if( RAPTOR_UTF8 && (utfOrNo = *str) & xooooooo ){
+    for ( i = 1, utfOrNo <<= 1; utfOrNo & xooooooo; i++, utfOrNo <<= 1 )
+      if( i >= len || (str[ i ] & xxoooooo) != xooooooo ) return 1;
+
+    if( i >= 2 && i <= 8 ) return i;
+  }
+
+  return 1;
+}
+
+static int utf8lead( const char *str, const int len ){
+  const int width = RAPTOR_UTF8 ? "\1\1\1\1\1\1\1\1\1\1\1\1\2\2\3\4"[ (unsigned char)*str >> 4 ] : 1;
+  return width < len ? width : len;
+}
+
+static unsigned long long keyUtf8( const char *str, const int len ){
+  unsigned long long key = 0;
+  for( int i = 0; i < 8; i++ ) key = key << 8 | (i < len ? (unsigned char)str[ i ] : 0);
+  return key;
+}
+
+static int decodeUtf8( const char *str, const int width ){
+  int cp = width > 1 ? (unsigned char)*str & (0x7F >> width) : (unsigned char)*str;
+  for( int i = 1; i < width; i++ ) cp = cp << 6 | (str[ i ] & 0x3F);
+  return width > 4 || (width == 1 && *str & xooooooo) ? -1 : cp;
+}
+
+static int encodeUtf8( const int cp, char *str ){
+  const int width = cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+  str[ 0 ] = width == 1 ? cp : (0xF00 >> width) | cp >> (6 * (width - 1));
+  for( int i = 1; i < width; i++ ) str[ i ] = xooooooo | (cp >> (6 * (width - 1 - i)) & 0x3F);
+  return width;
+}
+
+static void foldUtf8( char *str, const int width ){
+  const int cp = decodeUtf8( str, width );
+  if( foldCode( cp ) != cp ) encodeUtf8( foldCode( cp ), str );
+}
+
+static unsigned long long keyCode( const int cp ){
+  char str[ 4 ];
+  return keyUtf8( str, encodeUtf8( cp, str ) );
+}
+
+static int isFold( const struct TABLE *entry ){
+  return RAPTOR_UTF8 && entry->command == COM_UTF8 && entry->mods & MOD_COMMUNISM;
+}
+
+static int wideMeta( const struct TABLE *entry ){
+  return RAPTOR_UTF8 && entry->command == COM_META && memChr( "adws", entry->chr, 4 ) != 0;
+}
+
+static int countRaptor( struct RAPTOR *raptor, struct ENGINE *engine, const char *re, const int len ){
+  raptor->table   = NIL;
+  raptor->engine  = engine;
+  raptor->utf8    = RAPTOR_UTF8;
+  engine->trie    = NIL;
+  engine->back    = NIL;
+  engine->ranges  = NIL;
+  engine->setMax  = 0;
+
+  if( genTable( raptor, re, len ) == 0 ) return 0;
+  if( engine->loopsOver ) return -1;
+
+  return sizeof( struct ENGINE ) + raptor->index * sizeof( struct TABLE ) + (sizeBack( raptor ) + engine->rangeLen) * sizeof( unsigned long long ) +
+         (engine->setIndex + engine->setMax) * 32 + sizeTrie( raptor ) * sizeof( int ) + engine->poolLen;
+}
+
+int sizeRaptor( const char *re, const int len ){
+  struct RAPTOR raptor;
+  struct ENGINE engine;
+  return countRaptor( &raptor, &engine, re, len );
+}
+
+static struct ENGINE empty;
+
+static void emptyRaptor( struct RAPTOR *raptor ){
+  raptor->table  = NIL;
+  raptor->index  = 0;
+  raptor->mods   = 0;
+  raptor->depth  = 0;
+  raptor->engine = &empty;
+}
+
+static void placeRaptor( struct RAPTOR *raptor, struct ENGINE *engine, const int entries, const int back, const int ranges, const int sets, const int trie ){
+  raptor->engine = engine;
+  raptor->utf8   = RAPTOR_UTF8;
+  raptor->table  = (struct TABLE *)(engine + 1);
+  engine->back   = back ? (unsigned long long *)(raptor->table + entries) : NIL;
+  engine->ranges = (unsigned long long *)(raptor->table + entries) + back;
+  engine->sets   = (unsigned char (*)[ 32 ])(engine->ranges + ranges);
+  engine->setMax = sets;
+  engine->trie   = (int *)(engine->sets + sets);
+  engine->pool   = (char *)(engine->trie + trie);
+}
+
+static int fillRaptor( struct RAPTOR *raptor, const char *re, const int len, const int shot ){
+  struct ENGINE *engine = raptor->engine;
+  if( genTable( raptor, re, len ) == 0 || engine->loopsOver ){
+    emptyRaptor( raptor );
+    return engine->loopsOver ? -1 : 0;
+  }
+
+  genSets  ( raptor );
+  genRuns  ( raptor );
+  genPrefix( raptor );
+  genFirst ( raptor );
+  genDepth ( raptor );
+  engine->positions = 0;
+  engine->hooks     = 0;
+  engine->wide      = FALSE;
+  if( shot ){
+    engine->nodes      = 0;
+    engine->innerLen   = 0;
+    engine->backStates = 0;
+    engine->reach      = INNER_FAR;
+    return raptor->index;
+  }
+
+  genTrie  ( raptor );
+  genInner ( raptor );
+  genBack  ( raptor );
+  genDfa   ( raptor );
+  return raptor->index;
+}
+
+static int buildRaptor( struct RAPTOR *raptor, struct ARENA *arena, const char *re, const int len, const int shot ){
+  struct ENGINE  count, *engine;
+  const int align = sizeof( const char * ), size = countRaptor( raptor, &count, re, len ), used = (arena->used + align - 1) / align * align;
+
+  if( size <= 0 || (used + size > arena->size && (arena->grow == NIL || !arena->grow( arena, used + size ))) ){
+    emptyRaptor( raptor );
+    return size ? -1 : 0;
+  }
+
+  arena->used = used + size;
+  engine      = (struct ENGINE *)(arena->mem + used);
+  *engine     = count;
+  placeRaptor( raptor, engine, raptor->index, sizeBack( raptor ), count.rangeLen, count.setIndex + count.setMax, sizeTrie( raptor ) );
+  return fillRaptor( raptor, re, len, shot );
+}
+
+int compileRaptor( struct RAPTOR *raptor, struct ARENA *arena, const char *re, const int len ){
+  return buildRaptor( raptor, arena, re, len, FALSE );
+}
+
+int sizePack( const char **re, const int *lens, const int count ){
+  const int align = sizeof( const char * );
+  int       size  = align + count * (int)sizeof( struct RAPTOR ) + 256 * ((count + 31) / 32) * (int)sizeof( unsigned );
+
+  for( int id = 0, one; id < count; id++ ){
+    if( (one = sizeRaptor( re[ id ], lens ? lens[ id ] : strLen( re[ id ] ) )) < 0 ) return -1;
+    size += one + align;
+  }
+  return size;
+}
+
+int compilePack( struct PACK *pack, struct ARENA *arena, const char **re, const int *lens, const int count ){
+  const int align = sizeof( const char * ), size = sizePack( re, lens, count ), used = (arena->used + align - 1) / align * align;
+
+  pack->count = 0;
+  if( count <= 0 ) return 0;
+  if( size < 0 || (used + size > arena->size && (arena->grow == NIL || !arena->grow( arena, used + size ))) ) return -1;
+
+  pack->raptor   = (struct RAPTOR *)(arena->mem + used);
+  pack->words    = (count + 31) / 32;
+  pack->bucket   = (unsigned *)(pack->raptor + count);
+  pack->depth    = 0;
+  pack->anyFirst = FALSE;
+  arena->used    = (char *)(pack->bucket + 256 * pack->words) - arena->mem;
+  for( int i = 0; i < 32; i++ ) pack->first[ i ] = 0;
+  for( int i = 0; i < 256 * pack->words; i++ ) pack->bucket[ i ] = 0;
+
+  for( int id = 0; id < count; id++ ){
+    struct RAPTOR *raptor = &pack->raptor[ id ];
+    if( compileRaptor( raptor, arena, re[ id ], lens ? lens[ id ] : strLen( re[ id ] ) ) <= 0 ){
+      pack->count = id;
+      return -1;
+    }
+
+    if( raptor->depth > pack->depth ) pack->depth = raptor->depth;
+    if( raptor->engine->anyFirst ) pack->anyFirst = TRUE;
+    for( int c = 0; c < 256; c++ )
+      if( raptor->engine->anyFirst || getBit( raptor->engine->first, c ) ){
+        setBit( pack->first, c );
+        pack->bucket[ c * pack->words + id / 32 ] |= 1u << (id % 32);
+      }
+  }
+
+  pack->count = count;
+  return count;
+}
+
+static int genTable( struct RAPTOR *raptor, const char *re, const int len ){
+  struct ENGINE *engine = raptor->engine;
+  struct RE    rexp;
+  rexp.ptr     = re;
+  rexp.type    = PATH;
+  rexp.len     = len;
+  rexp.mods    = 0;
+  rexp.index   = 0;
+  rexp.loopsMin = rexp.loopsMax = 1;
+  raptor->index = 0;
+  engine->setIndex = 0;
+  engine->rangeLen = 0;
+  engine->poolLen  = 0;
+  engine->loopsOver = FALSE;
+  engine->nodes    = 0;
+
+  if( rexp.len <= 0 ) return 0;
+
+  getMods( &rexp, &rexp );
+  raptor->mods = rexp.mods;
+
+  if( isPath( &rexp ) ){
+    genPaths( raptor, rexp );
+    engine->nodes = countPaths( rexp ) >= TRIE_PATHS ? engine->poolLen + 1 : 0;
+  } else genTracks( raptor, &rexp );
+
+  tableAppend( raptor, NIL, COM_END );
+  return raptor->index;
+}
+
+static void tableAppend( struct RAPTOR *raptor, struct RE *rexp, enum COMMAND command ){
+  struct ENGINE *engine = raptor->engine;
+  struct TABLE *entry;
+
+  for( struct RE chunk; command == COM_SIMPLE && rexp->len > MAX_LITERAL; cutRexp( rexp, MAX_LITERAL ) ){
+    chunk     = *rexp;
+    chunk.len = MAX_LITERAL;
+    tableAppend( raptor, &chunk, command );
+  }
+
+  if( rexp && (rexp->loopsMin >= MAX_LOOPS || (rexp->loopsMax >= MAX_LOOPS && rexp->loopsMax != INF)) ) engine->loopsOver = TRUE;
+
+  if( raptor->table == NIL ){
+    if( rexp ) rexp->index = raptor->index;
+    if( rexp && rexp->loopsMax > 1 && (command == COM_META || command == COM_POINT) ) engine->setMax++;
+    if( rexp && (command == COM_SIMPLE || command == COM_UTF8) ) engine->poolLen += rexp->len;
+
+    raptor->index++;
+    return;
+  }
+
+  entry           = &raptor->table[ raptor->index ];
+  entry->command  = command;
+  entry->run      = RUN_MATCH;
+  entry->mods     = 0;
+  entry->chr      = 0;
+  entry->loopsMin = 1;
+  entry->loopsMax = 1;
+  entry->close    = raptor->index;
+  entry->arg      = 0;
+
+  if( rexp ) {
+    rexp->index     = raptor->index;
+    entry->mods     = rexp->mods;
+    entry->loopsMin = rexp->loopsMin;
+    entry->loopsMax = rexp->loopsMax == INF ? MAX_LOOPS : rexp->loopsMax;
+
+    switch( command ){
+    case COM_SIMPLE :
+    case COM_UTF8   :
+      entry->chr = rexp->len;
+      entry->arg = engine->poolLen;
+      for( int i = 0; i < rexp->len; i++ )
+        engine->pool[ engine->poolLen++ ] = rexp->mods & MOD_COMMUNISM ? toLower( rexp->ptr[ i ] ) : rexp->ptr[ i ];
+      if( isFold( entry ) ) foldUtf8( engine->pool + entry->arg, entry->chr );
+      break;
+    case COM_META   : entry->chr = rexp->ptr[ 1 ]; break;
+    case COM_RANGEAB:
+      entry->chr = rexp->mods & MOD_COMMUNISM ? toLower( rexp->ptr[ 0 ] ) : rexp->ptr[ 0 ];
+      entry->arg = rexp->mods & MOD_COMMUNISM ? toLower( rexp->ptr[ rexp->len - 1 ] ) : rexp->ptr[ rexp->len - 1 ];
+      if     ( RAPTOR_UTF8 && entry->chr & xooooooo ){ entry->chr = 1; entry->arg = 0; }
+      else if( RAPTOR_UTF8 && entry->arg & xooooooo ) entry->arg = 0x7F;
+      break;
+    case COM_BACKREF: entry->arg = aToi( rexp->ptr + 1, rexp->len - 1 ); break;
+    default         : break;
+    }
+  }
+
+  raptor->index++;
+}
+
+static void tableClose( struct RAPTOR *raptor, const int index ){
+  if( raptor->table ) raptor->table[ index ].close = raptor->index;
+}
+
+static void genPaths( struct RAPTOR *raptor, struct RE rexp ){
+  struct RE track;
+  tableAppend( raptor, &rexp, COM_PATH_INI );
+
+  while( cutByType( &rexp, &track, PATH ) ){
+    tableAppend( raptor, &track,  COM_PATH_ELE );
+    genTracks( raptor, &track );
+    tableClose( raptor, track.index );
+  }
+
+  tableClose( raptor, rexp.index );
+  tableAppend( raptor, NIL, COM_PATH_END );
+}
+
+static void genTracks( struct RAPTOR *raptor, struct RE *rexp ){
+  struct RE track;
+  while( tracker( rexp, &track ) )
+    switch( track.type ){
+    case HOOK   :
+      tableAppend( raptor, &track, COM_HOOK_INI  );
+      if( isPath( &track ) ) genPaths ( raptor,  track );
+      else                   genTracks( raptor, &track );
+      tableClose( raptor, track.index );
+      tableAppend( raptor,    NIL, COM_HOOK_END  ); break;
+    case GROUP  :
+      tableAppend( raptor, &track, COM_GROUP_INI );
+      if( isPath( &track ) ) genPaths ( raptor,  track );
+      else                   genTracks( raptor, &track );
+      tableClose( raptor, track.index );
+      tableAppend( raptor,    NIL, COM_GROUP_END ); break;
+    case PATH   :                                   break;
+    case SET    : genSet     ( raptor, &track );    break;
+    case BACKREF: tableAppend( raptor, &track, COM_BACKREF ); break;
+    case META   : tableAppend( raptor, &track, COM_META    ); break;
+    case UTF8   : tableAppend( raptor, &track, COM_UTF8    ); break;
+    case POINT  : tableAppend( raptor, &track, COM_POINT   ); break;
+    default     : tableAppend( raptor, &track, COM_SIMPLE  ); break;
+    }
+}
+
+static int isPath( struct RE *rexp ){
+  for( int i = 0, deep = 0; (i += walkMeta( rexp->ptr + i, rexp->len - i )) < rexp->len; i++ )
+    switch( rexp->ptr[i] ){
+    case '(': case '<': deep++; break;
+    case ')': case '>': deep--; break;
+    case '[': i += walkSet( rexp->ptr + i, rexp->len - i ); break;
+    case '|': if( deep == 0 ) return TRUE;
+    }
+
+  return FALSE;
+}
+
+static int tracker( struct RE *rexp, struct RE *track ){
+  if( rexp->len == 0 ) return FALSE;
+
+  switch( RAPTOR_UTF8 && *rexp->ptr & xooooooo ? UTF8 : *rexp->ptr ){
+  case ':' : cutByLen ( rexp, track, rexp->len > 1 ? 2 : 1, rexp->len > 1 ? META : SIMPLE ); break;
+  case '.' : cutByLen ( rexp, track, 1,                    POINT   ); break;
+  case '@' : cutByLen ( rexp, track, 1 +
+                                    countCharDigits( rexp->ptr + 1, rexp->len - 1 ),
+                                                           BACKREF ); break;
+  case '(' : cutByType( rexp, track,                       GROUP   ); break;
+  case '<' : cutByType( rexp, track,                       HOOK    ); break;
+  case '[' : cutByType( rexp, track,                       SET     ); break;
+  case UTF8: cutByLen ( rexp, track, utf8meter( rexp->ptr, rexp->len ), UTF8    ); break;
+  default  : cutSimple( rexp, track                                ); break;
+  }
+
+  getLoops( rexp, track );
+  getMods ( rexp, track );
+  return TRUE;
+}
+
+static void cutSimple( struct RE *rexp, struct RE *track ){
+  for( int i = 1; i < rexp->len; i++ )
+    switch( RAPTOR_UTF8 && rexp->ptr[ i ] & xooooooo ? UTF8 : rexp->ptr[ i ] ){
+    case '(': case '<': case '[': case '@': case ':': case '.': case UTF8:
+      cutByLen( rexp, track, i, SIMPLE  ); return;
+    case '?': case '+': case '*': case '{': case '#':
+      if( i == 1 ) cutByLen( rexp, track,     1, SIMPLE );
+      else         cutByLen( rexp, track, i - 1, SIMPLE );
+      return;
+    }
+
+  cutByLen( rexp, track, rexp->len, SIMPLE  );
+}
+
+static void cutByLen( struct RE *rexp, struct RE *track, const int len, const int type ){
+  *track       = *rexp;
+  track->type  = type;
+  track->len   = len;
+  cutRexp( rexp, len );
+}
+
+static int cutByType( struct RE *rexp, struct RE *track, const int type ){
+  if( rexp->len == 0 ) return FALSE;
+
+  *track = *rexp;
+  track->type = type;
+  for( int cut, i = 0, deep = 0; (i += walkMeta( rexp->ptr + i, rexp->len - i )) < rexp->len; i++ ){
+    switch( rexp->ptr[ i ] ){
+    case '(': case '<': deep++; break;
+    case ')': case '>': deep--; break;
+    case '[': i += walkSet( rexp->ptr + i, rexp->len - i ); break;
+    }
+
+    if( i >= rexp->len ) break;
+
+    switch( type ){
+    case HOOK    : cut = deep == 0; break;
+    case GROUP   : cut = deep == 0; break;
+    case SET     : cut = rexp->ptr[i] == ']'; break;
+    case PATH    : cut = deep == 0 && rexp->ptr[i] == '|'; break;
+    }
+
+    if( cut ){
+      track->len  = i;
+      cutRexp( rexp, i + 1 );
+      if( type != PATH ) cutRexp( track, 1 );
+      return TRUE;
+    }
+  }
+
+  cutRexp( rexp, rexp->len );
+  if( type != PATH ) cutRexp( track, 1 );
+  return TRUE;
+}
+
+static void cutRexp( struct RE *rexp, const int len ){
+  rexp->ptr += len; rexp->len -= len;
+}
+
+static int walkSet( const char *str, const int len ){
+  for( int i = 0; (i += walkMeta( str + i, len - i )) < len; i++ )
+    if( str[i] == ']' ) return i;
+
+  return len;
+}
+
+static int walkMeta( const char *str, const int len ){
+  for( int i = 0; i < len; i += 2 )
+    if( str[i] != ':' ) return i;
+
+  return len;
+}
+
+static void getMods( struct RE *rexp, struct RE *track ){
+  int inMods = rexp->len && *rexp->ptr == '#', pos = 0;
+  while( inMods && ++pos < rexp->len )
+    switch( rexp->ptr[ pos ] ){
+    case '^': track->mods |=  MOD_ALPHA     ; break;
+    case '$': track->mods |=  MOD_OMEGA     ; break;
+    case '?': track->mods |=  MOD_LONLEY    ; break;
+    case '~': track->mods |=  MOD_FwrByChar ; break;
+    case '*': track->mods |=  MOD_COMMUNISM ; break;
+    case '/': track->mods &= ~MOD_COMMUNISM ; break;
+    default : inMods       =  FALSE         ; break;
+    }
+
+  cutRexp( rexp, pos );
+}
+
+static void getLoops( struct RE *rexp, struct RE *track ){
+  track->loopsMin = 1; track->loopsMax = 1;
+
+  if( rexp->len )
+    switch( *rexp->ptr ){
+    case '?' : cutRexp( rexp, 1 ); track->loopsMin = 0; track->loopsMax =   1; return;
+    case '+' : cutRexp( rexp, 1 ); track->loopsMin = 1; track->loopsMax = INF; return;
+    case '*' : cutRexp( rexp, 1 ); track->loopsMin = 0; track->loopsMax = INF; return;
+    case '{' : cutRexp( rexp, 1 );
+      track->loopsMin = countCharDigits( rexp->ptr, rexp->len ) > 9 ? MAX_LOOPS : aToi( rexp->ptr, rexp->len );
+      cutRexp( rexp, countCharDigits( rexp->ptr, rexp->len ) );
+      if( rexp->len && *rexp->ptr == ',' ){
+        cutRexp( rexp, 1 );
+        if( rexp->len && *rexp->ptr == '}' )
+          track->loopsMax = INF;
+        else {
+          track->loopsMax = countCharDigits( rexp->ptr, rexp->len ) > 9 ? MAX_LOOPS : aToi( rexp->ptr, rexp->len );
+          cutRexp( rexp, countCharDigits( rexp->ptr, rexp->len ) );
+        }
+      } else track->loopsMax = track->loopsMin;
+
+      if( rexp->len ) cutRexp( rexp, 1 );
+    }
+}
+
+static void genSet( struct RAPTOR *raptor, struct RE *rexp ){
+  struct ENGINE *engine = raptor->engine;
+  struct RE track;
+  const int head  = engine->rangeLen;
+  int       metas = 0;
+
+  if( rexp->ptr[0] == '^' ){
+    cutRexp( rexp, 1 );
+    rexp->mods |=  MOD_NEGATIVE;
+  }
+
+  tableAppend( raptor, rexp, COM_SET_INI );
+  if( raptor->table ) raptor->table[ rexp->index ].arg = engine->setIndex;
+  engine->setIndex++;
+  if( RAPTOR_UTF8 && raptor->table ) engine->ranges[ head ] = 0;
+  if( RAPTOR_UTF8 ) engine->rangeLen++;
+
+  while( trackerSet( rexp, &track ) ){
+    switch( track.type ){
+    case META   : tableAppend( raptor, &track, COM_META    ); metas++; break;
+    case RANGEAB: tableAppend( raptor, &track, COM_RANGEAB ); rangeAppend( raptor, head, &track ); break;
+    case UTF8   : tableAppend( raptor, &track, COM_UTF8    ); rangeAppend( raptor, head, &track ); break;
+    default     : tableAppend( raptor, &track, COM_SIMPLE  ); break;
+    }
+  }
+
+  tableClose( raptor, rexp->index );
+  tableAppend( raptor, NIL, COM_SET_END );
+  if( RAPTOR_UTF8 && raptor->table ){
+    raptor->table[ raptor->index - 1 ].chr = metas != 0;
+    raptor->table[ raptor->index - 1 ].arg = head;
+    rangeMerge( engine->ranges + head );
+  }
+}
+
+static void rangeAppend( struct RAPTOR *raptor, const int head, const struct RE *rexp ){
+  const int          width = utf8meter( rexp->ptr, rexp->len ), high = rexp->type == RANGEAB ? width + 1 : 0;
+  unsigned long long lo    = keyUtf8( rexp->ptr, width ), hi = keyUtf8( rexp->ptr + high, rexp->len - high );
+
+  if( lo < WIDE_KEY ) lo = WIDE_KEY;
+  if( !RAPTOR_UTF8 || hi < lo ) return;
+  rangePair( raptor, head, lo, hi );
+  if( !(rexp->mods & MOD_COMMUNISM) ) return;
+
+  for( int cp = lo == WIDE_KEY ? 0x80 : decodeUtf8( rexp->ptr, width ), last = decodeUtf8( rexp->ptr + high, rexp->len - high ), from = 0, to = 0;
+       cp <= last + 1; cp++ ){
+    const int fold = cp <= last ? foldCode( cp ) : cp;
+    if( to && (fold == cp || fold != to + 1) ){
+      rangePair( raptor, head, keyCode( from ), keyCode( to ) );
+      to = 0;
+    }
+
+    if( fold != cp ){
+      if( to == 0 ) from = fold;
+      to = fold;
+    }
+  }
+}
+
+static void rangePair( struct RAPTOR *raptor, const int head, const unsigned long long lo, const unsigned long long hi ){
+  struct ENGINE *engine = raptor->engine;
+  if( raptor->table ){
+    engine->ranges[ engine->rangeLen     ] = lo;
+    engine->ranges[ engine->rangeLen + 1 ] = hi;
+    engine->ranges[ head ]++;
+  }
+
+  engine->rangeLen += 2;
+}
+
+static void rangeMerge( unsigned long long *range ){
+  unsigned long long *pair = range + 1, swap;
+  int count = 0;
+
+  for( int i = 1; i < (int)range[ 0 ]; i++ )
+    for( int j = 2 * i; j > 0 && pair[ j ] < pair[ j - 2 ]; j -= 2 )
+      for( int k = 0; k < 2; k++ ){ swap = pair[ j + k ]; pair[ j + k ] = pair[ j - 2 + k ]; pair[ j - 2 + k ] = swap; }
+
+  for( int i = 0; i < (int)range[ 0 ]; i++ )
+    if( count && pair[ 2 * i ] <= pair[ 2 * count - 1 ] ){
+      if( pair[ 2 * i + 1 ] > pair[ 2 * count - 1 ] ) pair[ 2 * count - 1 ] = pair[ 2 * i + 1 ];
+    } else {
+      pair[ 2 * count     ] = pair[ 2 * i     ];
+      pair[ 2 * count + 1 ] = pair[ 2 * i + 1 ];
+      count++;
+    }
+
+  range[ 0 ] = count;
+}
+
+static void genPrefix( struct RAPTOR *raptor ){
+  struct ENGINE *engine = raptor->engine;
+  engine->prefix    = NIL;
+  engine->prefixLen = 0;
+
+  for( int i = 0; ( raptor->table[ i ].command == COM_SIMPLE || raptor->table[ i ].command == COM_UTF8 ); i++ ){
+    const struct TABLE *entry = &raptor->table[ i ];
+    if( entry->loopsMin == 0 || entry->mods & MOD_COMMUNISM ) return;
+    if( engine->prefixLen == 0 ) engine->prefix = engine->pool + entry->arg;
+
+    engine->prefixLen += entry->chr;
+    if( entry->loopsMax != 1 ) return;
+  }
+}
+
+static int trackerSet( struct RE *rexp, struct RE *track ){
+  if( rexp->len == 0 ) return FALSE;
+
+  const int width = utf8meter( rexp->ptr, rexp->len );
+  switch( RAPTOR_UTF8 && *rexp->ptr & xooooooo ? UTF8 : *rexp->ptr ){
+  case UTF8:
+    if( (int)rexp->len > width + 1 && rexp->ptr[ width ] == '-' ){
+      const int high = utf8meter( rexp->ptr + width + 1, rexp->len - width - 1 );
+      if( keyUtf8( rexp->ptr + width + 1, high ) >= keyUtf8( rexp->ptr, width ) ){
+        cutByLen( rexp, track, width + 1 + high, RANGEAB );
+        break;
+      }
+    }
+
+    cutByLen( rexp, track, width, UTF8 );
+    break;
+  case ':' : if( rexp->len > 1 ){ cutByLen( rexp, track, 2, META ); break; }
+             // fallthrough
+  default  :
+    for( int i = 1; i < rexp->len; i++ )
+      switch( RAPTOR_UTF8 && rexp->ptr[ i ] & xooooooo ? UTF8 : rexp->ptr[ i ] ){
+      case ':': case UTF8:
+        cutByLen( rexp, track, i, SIMPLE  ); goto setL;
+      case '-':
+        if     ( i == 1 && rexp->len > 2 ) cutByLen( rexp, track, 2 + utf8meter( rexp->ptr + 2, rexp->len - 2 ), RANGEAB );
+        else if( i == 1                  ) cutByLen( rexp, track,     2, SIMPLE  );
+        else                               cutByLen( rexp, track, i - 1, SIMPLE  );
+        goto setL;
+      }
+
+    cutByLen( rexp, track, rexp->len, SIMPLE  );
+  }
+
+ setL:
+  track->loopsMin = track->loopsMax = 1;
+  return TRUE;
+}
+
+static int  trekking     ( struct CONTEXT *ctx, struct TRACK *stack );
+static int  looper       ( struct CONTEXT *ctx, const int index );
+static int  maxLoops     ( const struct TABLE *entry );
+
+static int  match        ( struct CONTEXT *ctx, const int  index );
+static int  matchSet     ( struct CONTEXT *ctx, const int  index );
+static int  matchWide    ( struct CONTEXT *ctx, const int  index );
+static int  matchBackRef ( struct CONTEXT *ctx, const int  index );
+static int  matchMeta    ( struct CONTEXT *ctx, const int  index, const char *txt );
+static int  matchClass   ( const int meta, const char *txt, const int width );
+static int  matchText    ( struct CONTEXT *ctx, const int  index, const char *txt );
+
+static void openCatch    ( struct CONTEXT *ctx, int *index );
+static void closeCatch   ( struct CONTEXT *ctx, const int  index );
+static int  growCatch    ( struct CONTEXT *ctx );
+static void startCatch   ( struct CONTEXT *ctx );
+static void endCatch     ( struct CONTEXT *ctx );
+static int  lastIdCatch  ( struct CONTEXT *ctx, const int  id    );
+
+static int meterCtx( const struct CONTEXT *ctx, const char *str, const int len ){
+  return ctx->trusted ? utf8lead( str, len ) : utf8meter( str, len );
+}
+
+static int metaByte( const int meta, const int chr ){
+  if( RAPTOR_UTF8 && chr & xooooooo ) return memChr( "ADWS&", meta, 5 ) != 0 || (char)chr == (char)meta;
+
+  switch( meta ){
+  case 'a' : return  isAlpha( chr );
+  case 'A' : return !isAlpha( chr );
+  case 'd' : return  isDigit( chr );
+  case 'D' : return !isDigit( chr );
+  case 'w' : return  isAlnum( chr );
+  case 'W' : return !isAlnum( chr );
+  case 's' : return  isSpace( chr );
+  case 'S' : return !isSpace( chr );
+  case '&' : return !RAPTOR_UTF8 && (char)chr == (char)meta;
+  default  : return (char)chr == (char)meta;
+  }
+}
+
+static void metaBits( const int meta, unsigned char *bits, const int chars ){
+  unsigned char own[ 32 ] = { 0 };
+
+  switch( toLower( meta ) ){
+  case 'w' :
+  case 'd' : for( int c = '0'; c <= '9'; c++ ) setBit( own, c );
+             if( toLower( meta ) == 'd' ) break;
+             // fallthrough
+  case 'a' : for( int c = 'A'; c <= 'Z'; c++ ){ setBit( own, c ); setBit( own, c + 32 ); } break;
+  case 's' : for( int c = '\t'; c <= '\r'; c++ ) setBit( own, c ); setBit( own, ' ' ); break;
+  case '&' : if( RAPTOR_UTF8 ) setBits( own, xooooooo, 256 ); else setBit( own, meta ); break;
+  default  : setBit( own, meta ); break;
+  }
+
+  if( memChr( "ADWS", meta, 4 ) ) for( int i = 0; i < 32; i++ ) own[ i ] = ~own[ i ];
+  for( int i = 0; i < chars / 8; i++ ) bits[ i ] |= own[ i ];
+}
+
+static void setChar( unsigned char *bits, const int chr ){
+#if RAPTOR_UTF8
+  if( (unsigned char)chr >= SET_CHARS ) return;
+#endif
+  setBit( bits, chr );
+}
+
+static void setMember( const struct RAPTOR *raptor, const int index, unsigned char *bits ){
+  const struct ENGINE *engine = raptor->engine;
+  const struct TABLE  *entry  = &raptor->table[ index ];
+  const int            fold   = entry->mods & MOD_COMMUNISM;
+
+  switch( entry->command ){
+  case COM_RANGEAB:
+    for( int c = (char)entry->chr; c <= entry->arg; c++ ){
+      if( !fold || !isLower( c ) ) setChar( bits, c );
+      if(  fold &&  isUpper( c ) ) setChar( bits, c - 32 );
+    }
+    break;
+  case COM_META   : metaBits( entry->chr, bits, SET_CHARS ); break;
+  case COM_SIMPLE :
+    for( int i = 0; i < entry->chr; i++ ){
+      const int c = fold ? toLower( engine->pool[ entry->arg + i ] ) : engine->pool[ entry->arg + i ];
+      setChar( bits, c );
+      if( fold && isUpper( c ) ) setChar( bits, c - 32 );
+    }
+    break;
+  default         : break;
+  }
+}
+
+static void genSets( struct RAPTOR *raptor ){
+  for( int index = 0; index < raptor->index; index++ )
+    if( raptor->table[ index ].command == COM_SET_INI ){
+      const struct TABLE *entry = &raptor->table[ index ];
+      unsigned char      *bits  = raptor->engine->sets[ entry->arg ];
+      for( int c = 0; c < 32; c++ ) bits[ c ] = 0;
+      for( int i = index + 1; i < entry->close; i++ ) setMember( raptor, i, bits );
+      for( int c = 0; entry->mods & MOD_NEGATIVE && c < SET_CHARS / 8; c++ ) bits[ c ] = ~bits[ c ];
+    }
+}
+
+static int byteMember( const struct RAPTOR *raptor, const int index, const int chr ){
+  const struct TABLE *entry = &raptor->table[ index ];
+  switch( entry->command ){
+  case COM_SET_INI: return RAPTOR_UTF8 && chr & xooooooo ? wideSet( raptor, index ) : getBit( raptor->engine->sets[ entry->arg ], chr ) != 0;
+  case COM_META   : return metaByte( entry->chr, chr );
+  case COM_POINT  : return TRUE;
+  default         : return FALSE;
+  }
+}
+
+static void genRuns( struct RAPTOR *raptor ){
+  struct ENGINE *engine = raptor->engine;
+  for( int index = 0; index < raptor->index; index++ ){
+    struct TABLE  *entry = &raptor->table[ index ];
+    unsigned char *bits  = NIL;
+    if( entry->command < COM_SET_INI || entry->command == COM_SET_END || entry->command == COM_END ) continue;
+
+    index = entry->close;
+    if( entry->loopsMax < 2 ) continue;
+
+    switch( entry->command ){
+    case COM_SET_INI: bits = engine->sets[ entry->arg ]; break;
+    case COM_POINT  : entry->run = RUN_POINT; break;
+    case COM_META   :
+      if( engine->setIndex == engine->setMax ) break;
+      entry->arg = engine->setIndex++;
+      bits       = engine->sets[ entry->arg ];
+      for( int c = 0; c < 32 ; c++ ) bits[ c ] = 0;
+      metaBits( entry->chr, bits, SET_CHARS );
+      break;
+    default         : break;
+    }
+
+    if( bits ){
+      int misses = 0, stop = 0;
+      for( int i = 0; i < 32 && misses < 2; i++ )
+        for( int k = 0; bits[ i ] != 0xFF && k < 8; k++ )
+          if( !(bits[ i ] >> k & 1) ){ misses++; stop = 8 * i + k; }
+
+      entry->run = RUN_SET;
+      if( misses == 1 && entry->command == COM_SET_INI ){
+        entry->run = RUN_NOT;
+        entry->chr = stop;
+      }
+    } else if( entry->command == COM_SIMPLE && entry->chr == 1 ) entry->run = RUN_BYTE;
+    else if( !(entry->mods & MOD_COMMUNISM) && (entry->command == COM_SIMPLE || entry->command == COM_UTF8) ) entry->run = RUN_TEXT;
+  }
+}
+
+static void firstWide( struct RAPTOR *raptor, const int index ){
+  struct ENGINE *engine = raptor->engine;
+  const unsigned long long *range = engine->ranges + raptor->table[ raptor->table[ index ].close ].arg;
+  const int all = raptor->table[ raptor->table[ index ].close ].chr || (range[ 0 ] && raptor->table[ index ].mods & (MOD_NEGATIVE | MOD_COMMUNISM));
+
+  if( all ) setBits( engine->first, xooooooo, 256 );
+  for( int i = 0; i < (int)range[ 0 ]; i++ )
+    for( int c = range[ 2 * i + 1 ] >> 56; c <= (int)(range[ 2 * i + 2 ] >> 56); c++ ) setBit( engine->first, c );
+}
+
+static int firstSet( struct RAPTOR *raptor, int index ){
+  struct ENGINE *engine = raptor->engine;
+  for( int nullable; ; index = raptor->table[ index ].close + 1 ){
+    const struct TABLE *entry = &raptor->table[ index ];
+    switch( entry->command ){
+    case COM_END      : case COM_PATH_END: case COM_PATH_ELE:
+    case COM_GROUP_END: case COM_HOOK_END: case COM_SET_END : return TRUE;
+    case COM_PATH_INI :
+      nullable = FALSE;
+      for( int i = index + 1; raptor->table[ i ].command == COM_PATH_ELE; i = raptor->table[ i ].close )
+        nullable |= firstSet( raptor, i + 1 );
+      break;
+    case COM_GROUP_INI:
+    case COM_HOOK_INI : nullable = firstSet( raptor, index + 1 ) || entry->loopsMin == 0; break;
+    case COM_SIMPLE   :
+    case COM_UTF8     :
+      if( isFold( entry ) ) setBits( engine->first, xxoooooo, 256 );
+      setBit( engine->first, engine->pool[ entry->arg ] );
+      if( entry->mods & MOD_COMMUNISM && isUpper( engine->pool[ entry->arg ] ) ) setBit( engine->first, engine->pool[ entry->arg ] - 32 );
+      nullable = entry->loopsMin == 0; break;
+    case COM_BACKREF  :
+      setBits( engine->first, 0, 256 );
+      nullable = entry->loopsMin == 0; break;
+    case COM_SET_INI  :
+      for( int i = 0; i < 32; i++ ) engine->first[ i ] |= engine->sets[ entry->arg ][ i ];
+      if( RAPTOR_UTF8 && entry->mods & MOD_NEGATIVE ) setBits( engine->first, xooooooo, 256 );
+      if( RAPTOR_UTF8 ) firstWide( raptor, index );
+      nullable = entry->loopsMin == 0; break;
+    case COM_META     :
+      metaBits( entry->chr, engine->first, 256 );
+      if( wideMeta( entry ) ) setBits( engine->first, xooooooo, 256 );
+      nullable = entry->loopsMin == 0; break;
+    default           :
+      setBits( engine->first, 0, 256 );
+      nullable = entry->loopsMin == 0; break;
+    }
+
+    if( !nullable ) return FALSE;
+  }
+}
+
+static int countPaths( struct RE rexp ){
+  struct RE track;
+  int paths = 0;
+  while( cutByType( &rexp, &track, PATH ) ) paths++;
+  return paths;
+}
+
+static int sizeTrie( const struct RAPTOR *raptor ){
+  const struct ENGINE *engine = raptor->engine;
+  return engine->nodes ? 256 + TRIE_NODE * engine->nodes : 0;
+}
+
+static int childTrie( const int *trie, const int node, const int chr ){
+  if( node == 0 ) return trie[ chr ];
+
+  for( int child = TRIE_AT( trie, node )[ TRIE_CHILD ]; child; child = TRIE_AT( trie, child )[ TRIE_NEXT ] )
+    if( TRIE_AT( trie, child )[ TRIE_CHR ] == chr ) return child;
+
+  return 0;
+}
+
+static int leadTrie( const struct RAPTOR *raptor, int index ){
+  while( (raptor->table[ index ].command == COM_HOOK_INI || raptor->table[ index ].command == COM_GROUP_INI) &&
+         raptor->table[ index ].loopsMin ) index++;
+
+  if( (raptor->table[ index ].command != COM_SIMPLE && raptor->table[ index ].command != COM_UTF8) || isFold( &raptor->table[ index ] ) ) return 0;
+  return raptor->table[ index ].loopsMin ? index : 0;
+}
+
+static void genTrie( struct RAPTOR *raptor ){
+  struct ENGINE *engine = raptor->engine;
+  int *trie = engine->trie, *node, nodes = 1, head = 0, tail = 0;
+  engine->trieMax  = 0;
+  engine->trieFold = FALSE;
+
+  if( engine->nodes == 0 ) return;
+  engine->nodes = 0;
+  for( int i = 1; raptor->table[ i ].command == COM_PATH_ELE; i = raptor->table[ i ].close ){
+    const int lead = leadTrie( raptor, i + 1 );
+    if( lead == 0 ) return;
+    for( int index = lead; raptor->table[ index ].command == COM_SIMPLE || raptor->table[ index ].command == COM_UTF8; index++ )
+      if( raptor->table[ index ].mods & MOD_COMMUNISM ) engine->trieFold = TRUE;
+  }
+
+  for( int c = 0; c < 256; c++ ) trie[ c ] = 0;
+  node = TRIE_AT( trie, 0 );
+  node[ TRIE_CHILD ] = node[ TRIE_FAIL ] = node[ TRIE_DEPTH ] = 0;
+
+  for( int i = 1; raptor->table[ i ].command == COM_PATH_ELE; i = raptor->table[ i ].close ){
+    int at = 0, depth = 0;
+    for( int index = leadTrie( raptor, i + 1 ); ; index++ ){
+      const struct TABLE *entry = &raptor->table[ index ];
+      if( (entry->command != COM_SIMPLE && entry->command != COM_UTF8) || entry->loopsMin == 0 || isFold( entry ) ) break;
+
+      for( int k = 0; k < entry->chr; k++, depth++ ){
+        int chr = (unsigned char)engine->pool[ entry->arg + k ], next;
+        if( engine->trieFold ) chr = toLower( chr );
+        if( (next = childTrie( trie, at, chr )) == 0 ){
+          node               = TRIE_AT( trie, next = nodes++ );
+          node[ TRIE_CHR   ] = chr;
+          node[ TRIE_CHILD ] = node[ TRIE_FAIL ] = node[ TRIE_DEPTH ] = 0;
+          if( at == 0 ) trie[ chr ] = next;
+          else {
+            node[ TRIE_NEXT ] = TRIE_AT( trie, at )[ TRIE_CHILD ];
+            TRIE_AT( trie, at )[ TRIE_CHILD ] = next;
+          }
+        }
+
+        at = next;
+      }
+
+      if( entry->loopsMax != 1 ) break;
+    }
+
+    TRIE_AT( trie, at )[ TRIE_DEPTH ] = depth;
+    if( depth > engine->trieMax ) engine->trieMax = depth;
+  }
+
+  for( int c = 0; c < 256; c++ )
+    if( trie[ c ] ) TRIE_AT( trie, tail++ )[ TRIE_QUEUE ] = trie[ c ];
+
+  while( head < tail ){
+    const int from = TRIE_AT( trie, head++ )[ TRIE_QUEUE ];
+    for( int child = TRIE_AT( trie, from )[ TRIE_CHILD ]; child; child = TRIE_AT( trie, child )[ TRIE_NEXT ] ){
+      int fail = TRIE_AT( trie, from )[ TRIE_FAIL ], chr = TRIE_AT( trie, child )[ TRIE_CHR ];
+      while( fail && childTrie( trie, fail, chr ) == 0 ) fail = TRIE_AT( trie, fail )[ TRIE_FAIL ];
+
+      node              = TRIE_AT( trie, child );
+      node[ TRIE_FAIL ] = childTrie( trie, fail, chr );
+      if( node[ TRIE_DEPTH ] == 0 ) node[ TRIE_DEPTH ] = TRIE_AT( trie, node[ TRIE_FAIL ] )[ TRIE_DEPTH ];
+      TRIE_AT( trie, tail++ )[ TRIE_QUEUE ] = child;
+    }
+  }
+
+  engine->nodes = nodes;
+}
+
+static int addWidth( const int width, const int add, const int loops ){
+  const long long sum = width + (long long)add * loops;
+  return sum < INNER_FAR ? sum : INNER_FAR;
+}
+
+static void widthTable( const struct RAPTOR *raptor, int index, const int end, int *min, int *max ){
+  for( *min = *max = 0; index < end; index = raptor->table[ index ].close + 1 ){
+    const struct TABLE *entry = &raptor->table[ index ];
+    int lo = 1, hi = MAX_WIDTH;
+
+    switch( entry->command ){
+    case COM_SIMPLE   : case COM_UTF8     : lo = hi = entry->chr; break;
+    case COM_BACKREF  : lo = 0; hi = INNER_FAR; break;
+    case COM_HOOK_INI : case COM_GROUP_INI: widthTable( raptor, index + 1, entry->close, &lo, &hi ); break;
+    case COM_PATH_INI :
+      lo = INNER_FAR; hi = 0;
+      for( int i = index + 1, a, b; raptor->table[ i ].command == COM_PATH_ELE; i = raptor->table[ i ].close ){
+        widthTable( raptor, i + 1, raptor->table[ i ].close, &a, &b );
+        if( a < lo ) lo = a;
+        if( b > hi ) hi = b;
+      }
+
+      *min = addWidth( *min, lo, 1 );
+      *max = addWidth( *max, hi, 1 );
+      continue;
+    default           : break;
+    }
+
+    *min = addWidth( *min, lo, entry->loopsMin );
+    *max = addWidth( *max, hi, entry->loopsMax == MAX_LOOPS ? INNER_FAR : entry->loopsMax );
+  }
+}
+
+static int isInner( const struct TABLE *entry ){
+  if( entry->loopsMin == 0 ) return FALSE;
+  if( entry->command == COM_META ) return memChr( INNER_METAS, entry->chr, sizeof INNER_METAS - 1 ) == 0;
+  return (entry->command == COM_SIMPLE || entry->command == COM_UTF8) && !(entry->mods & MOD_COMMUNISM);
+}
+
+static void genInner( struct RAPTOR *raptor ){
+  struct ENGINE *engine = raptor->engine;
+  const int size = sizeof engine->inner;
+  int min = 0, max = 0, lead = 0, run = 0, runMin = 0, runMax = 0, best = 0, open = FALSE;
+  engine->innerLen = 0;
+
+  if( engine->prefixLen || engine->nodes ) return;
+  for( int index = 0, lo, hi; raptor->table[ index ].command != COM_END; ){
+    const struct TABLE *entry = &raptor->table[ index ];
+    if( ((entry->command == COM_HOOK_INI || entry->command == COM_GROUP_INI) && entry->loopsMin == 1 && entry->loopsMax == 1 &&
+         raptor->table[ index + 1 ].command != COM_PATH_INI) || entry->command == COM_HOOK_END || entry->command == COM_GROUP_END ){
+      open = FALSE;
+      index++;
+      continue;
+    }
+
+    if( isInner( entry ) ){
+      if( !open ){
+        lead   = index;
+        run    = 0;
+        runMin = min;
+        runMax = max;
+        open   = TRUE;
+      }
+
+      run += entry->command == COM_META ? 1 : entry->chr;
+      if( run >= size || entry->loopsMax != 1 ) open = FALSE;
+      if( (runMax < INNER_FAR ? size : 0) + run > best ){
+        best             = (runMax < INNER_FAR ? size : 0) + run;
+        engine->innerLen = run < size ? run : size;
+        engine->innerMin = runMin;
+        engine->innerMax = runMax;
+        for( int i = lead, n = 0; n < engine->innerLen; i++ )
+          if( raptor->table[ i ].command == COM_META ) engine->inner[ n++ ] = raptor->table[ i ].chr;
+          else for( int k = 0; k < raptor->table[ i ].chr && n < engine->innerLen; k++ )
+                 engine->inner[ n++ ] = engine->pool[ raptor->table[ i ].arg + k ];
+      }
+    } else open = FALSE;
+
+    widthTable( raptor, index, entry->close + 1, &lo, &hi );
+    min   = addWidth( min, lo, 1 );
+    max   = addWidth( max, hi, 1 );
+    index = entry->close + 1;
+  }
+
+  for( int c = 0; c < 256; c++ ) engine->skip[ c ] = engine->innerLen;
+  for( int i = 0; i + 1 < engine->innerLen; i++ )
+    engine->skip[ (unsigned char)engine->inner[ i ] ] = engine->innerLen - 1 - i;
+}
+
+static int wideSet( const struct RAPTOR *raptor, const int index ){
+  if( raptor->table[ index ].command != COM_SET_INI ) return FALSE;
+  if( raptor->table[ index ].mods & MOD_NEGATIVE ) return TRUE;
+
+  return RAPTOR_UTF8 && (raptor->engine->ranges[ raptor->table[ raptor->table[ index ].close ].arg ] || raptor->table[ raptor->table[ index ].close ].chr);
+}
+
+static int sizeBack( const struct RAPTOR *raptor ){
+  return raptor->mods & MOD_OMEGA ? BACK_SIZE : 0;
+}
+
+static int isBack( const struct TABLE *entry ){
+  switch( entry->command ){
+  case COM_SIMPLE: case COM_UTF8: case COM_SET_INI: case COM_META: case COM_POINT: return TRUE;
+  default        : return FALSE;
+  }
+}
+
+static int statesBack( const struct TABLE *entry ){
+  return (entry->command == COM_SIMPLE || entry->command == COM_UTF8) && !isFold( entry ) ? entry->chr : 1;
+}
+
+static int isLinear( const struct RAPTOR *raptor, const int index ){
+  const struct TABLE *entry = &raptor->table[ index ];
+  if( entry->command == COM_HOOK_END || entry->command == COM_GROUP_END ) return TRUE;
+  return (entry->command == COM_HOOK_INI || entry->command == COM_GROUP_INI) && entry->loopsMin == 1 && entry->loopsMax == 1 &&
+         raptor->table[ index + 1 ].command != COM_PATH_INI;
+}
+
+static int stepBack( const struct RAPTOR *raptor, const int index ){
+  return isLinear( raptor, index ) ? index + 1 : raptor->table[ index ].close + 1;
+}
+
+static void genBack( struct RAPTOR *raptor ){
+  struct ENGINE *engine = raptor->engine;
+  unsigned long long *back = engine->back, *follow = back + 256, clos = 1;
+  int lo, hi, from = 0, head = 0, states = 0, bit = 1;
+  widthTable( raptor, 0, raptor->index - 1, &lo, &hi );
+  engine->reach      = hi;
+  engine->backStates = 0;
+  engine->backHead   = 0;
+
+  if( back == NIL ) return;
+  for( int index = 0; index < raptor->index - 1; index = stepBack( raptor, index ) ){
+    if( isLinear( raptor, index ) ) continue;
+
+    widthTable( raptor, index, raptor->table[ index ].close + 1, &lo, &hi );
+    head = addWidth( head, hi, 1 );
+    if( !isBack( &raptor->table[ index ] ) ){
+      from = raptor->table[ index ].close + 1;
+      engine->backHead = head;
+    }
+  }
+
+  for( int index = from; index < raptor->index - 1; index = stepBack( raptor, index ) )
+    if( isBack( &raptor->table[ index ] ) ) states += statesBack( &raptor->table[ index ] );
+
+  for( ; states >= BACK_STATES; from = stepBack( raptor, from ) )
+    if( isBack( &raptor->table[ from ] ) ){
+      widthTable( raptor, from, raptor->table[ from ].close + 1, &lo, &hi );
+      engine->backHead = addWidth( engine->backHead, hi, 1 );
+      states -= statesBack( &raptor->table[ from ] );
+    }
+
+  for( int c = 0; c < 256; c++ ) back[ c ] = 0;
+  for( int index = from; index < raptor->index - 1; index = stepBack( raptor, index ) ){
+    const struct TABLE *entry = &raptor->table[ index ];
+    if( !isBack( entry ) ) continue;
+
+    if( (entry->command == COM_SIMPLE || entry->command == COM_UTF8) && !isFold( entry ) ){
+      const unsigned long long last = 1ULL << (bit + entry->chr - 1);
+      for( int t = 0; t < entry->chr; t++, bit++ ){
+        const int chr = (unsigned char)engine->pool[ entry->arg + t ];
+        for( int c = 0; c < 256; c++ )
+          if( (entry->mods & MOD_COMMUNISM ? toLower( c ) : c) == chr ) back[ c ] |= 1ULL << bit;
+        follow[ bit ] = t ? 1ULL << (bit - 1) : entry->loopsMax > 1 ? clos | last : clos;
+      }
+
+      clos = entry->loopsMin ? last : clos | last;
+    } else {
+      const int wide = entry->command == COM_POINT || isFold( entry ) || wideMeta( entry ) || wideSet( raptor, index ) ||
+                       byteMember( raptor, index, xooooooo | xxoooooo );
+      for( int c = 0; c < 256; c++ )
+        if( RAPTOR_UTF8 && c & xooooooo ? wide : byteMember( raptor, index, c ) ) back[ c ] |= 1ULL << bit;
+      clos = follow[ bit ] = clos | 1ULL << bit;
+      bit++;
+    }
+  }
+
+  follow[ 0 ]        = clos;
+  engine->backStates = bit > 1 ? bit : 0;
+}
+
+static void genFirst( struct RAPTOR *raptor ){
+  struct ENGINE *engine = raptor->engine;
+  for( int i = 0; i < 32; i++ ) engine->first[ i ] = 0;
+
+  engine->anyFirst = firstSet( raptor, 0 );
+  for( int i = 0; i < 32 && engine->first[ i ] == 0xFF; i++ )
+    if( i == 31 ) engine->anyFirst = TRUE;
+}
+
+static void genDepth( struct RAPTOR *raptor ){
+  int hooks = FALSE, refs = FALSE;
+  raptor->depth = 0;
+
+  for( int index = 0, depth = 0; index < raptor->index; index++ )
+    switch( raptor->table[ index ].command ){
+    case COM_PATH_INI : case COM_GROUP_INI: case COM_HOOK_INI:
+      if( ++depth > raptor->depth ) raptor->depth = depth;
+      if( raptor->table[ index ].command == COM_HOOK_INI ) hooks = TRUE;
+      break;
+    case COM_PATH_END : case COM_GROUP_END: case COM_HOOK_END: depth--; break;
+    case COM_BACKREF  : refs = TRUE; break;
+    default           : break;
+    }
+
+  raptor->engine->probe = hooks && !refs;
+}
+
+static int isText( const struct TABLE *entry ){
+  return (entry->command == COM_SIMPLE || entry->command == COM_UTF8) && entry->chr > 1;
+}
+
+static int slotsDfa( const struct TABLE *entry ){
+  if( isText( entry ) ) return entry->chr + 1;
+  return (entry->loopsMax == MAX_LOOPS ? entry->loopsMin : entry->loopsMax) + 1;
+}
+
+static int memberDfa( const struct RAPTOR *raptor, const int index, const int nth, const int chr ){
+  const struct ENGINE *engine = raptor->engine;
+  const struct TABLE  *entry  = &raptor->table[ index ];
+  if( entry->command != COM_SIMPLE && entry->command != COM_UTF8 ) return byteMember( raptor, index, chr );
+
+  if( entry->mods & MOD_COMMUNISM ) return cmpChrCommunist( chr, engine->pool[ entry->arg + nth ] ) != 0;
+  return (char)chr == engine->pool[ entry->arg + nth ];
+}
+
+static int afterDfa( const struct RAPTOR *raptor, const int index ){
+  return raptor->table[ index ].command == COM_HOOK_INI ? index + 1 : raptor->table[ index ].close + 1;
+}
+
+static int trackDfa( struct RAPTOR *raptor, int index ){
+  struct ENGINE *engine = raptor->engine;
+  for( int positions = 0, nullable = TRUE, hooks = 0; ; index = afterDfa( raptor, index ) ){
+    struct TABLE *entry = &raptor->table[ index ];
+    switch( entry->command ){
+    case COM_PATH_ELE: case COM_PATH_END: case COM_END  :
+      if( hooks > engine->hooks ) engine->hooks = hooks;
+      return nullable ? 0 : positions;
+    case COM_HOOK_INI:
+      if( entry->loopsMin != 1 || entry->loopsMax != 1 ) return 0;
+      entry->arg = raptor->table[ entry->close ].arg = hooks++;
+      continue;
+    case COM_HOOK_END: continue;
+    case COM_SET_INI : case COM_META    : case COM_POINT: case COM_SIMPLE: case COM_UTF8: break;
+    default          : return 0;
+    }
+
+    for( int c = xooooooo; RAPTOR_UTF8 && entry->command != COM_SIMPLE && entry->command != COM_UTF8 && c < 256; c++ )
+      if( byteMember( raptor, index, c ) ) engine->wide = TRUE;
+    if( isFold( entry ) || wideMeta( entry ) || (RAPTOR_UTF8 && wideSet( raptor, index )) ) engine->wide = TRUE;
+
+    if( isText( entry ) && (entry->loopsMin != 1 || entry->loopsMax != 1) ) return 0;
+    if( slotsDfa( entry ) > 256 ) return 0;
+    positions += slotsDfa( entry );
+
+    if( entry->loopsMin ) nullable = FALSE;
+  }
+}
+
+static void genDfa( struct RAPTOR *raptor ){
+  struct ENGINE *engine = raptor->engine;
+  int positions = 0, remap[ 256 ][ 2 ];
+  engine->positions  = 0;
+  engine->hooks      = 0;
+  engine->wide       = FALSE;
+  engine->classCount = 1;
+  for( int c = 0; c < 256; c++ ) engine->classes[ c ] = 0;
+
+  if( raptor->mods & MOD_FwrByChar ) return;
+  if( raptor->table[ 0 ].command == COM_PATH_INI ){
+    if( raptor->table[ raptor->table[ 0 ].close + 1 ].command != COM_END || raptor->mods & MOD_OMEGA ) return;
+    for( int i = 1, track; raptor->table[ i ].command == COM_PATH_ELE; i = raptor->table[ i ].close ){
+      if( (track = trackDfa( raptor, i + 1 )) == 0 ) return;
+      positions += track;
+    }
+  } else if( raptor->table[ raptor->table[ 0 ].close + 1 ].command != COM_END ) positions = trackDfa( raptor, 0 );
+
+  if( positions == 0 || positions > DFA_POSITIONS ) return;
+  for( int c = xooooooo; RAPTOR_UTF8 && c < xxoooooo; c++ )
+    if( getBit( engine->first, c ) ) engine->wide = TRUE;
+
+  for( int index = 0; index < raptor->index; index++ ){
+    const struct TABLE *entry = &raptor->table[ index ];
+    if( entry->command < COM_SET_INI || entry->command == COM_END ) continue;
+
+    for( int nth = 0; nth < (isText( entry ) ? entry->chr : 1); nth++ ){
+      int classes = 0;
+      for( int k = 0; k < engine->classCount; k++ ) remap[ k ][ 0 ] = remap[ k ][ 1 ] = -1;
+      for( int c = 0; c < 256; c++ ){
+        int *slot = &remap[ engine->classes[ c ] ][ memberDfa( raptor, index, nth, c ) ];
+        if( *slot < 0 ) *slot = classes++;
+        engine->classes[ c ] = *slot;
+      }
+
+      engine->classCount = classes;
+    }
+
+    index = entry->close;
+  }
+
+  engine->positions = positions;
+}
+
+static int nextFirst( const unsigned char *first, const char *txt, int i, const int len ){
+  for( int lead, from = i; (i = scanBits( first, txt, i, len )) < len; i = from ){
+    for( lead = i; RAPTOR_UTF8 && lead > from && lead > i - 8 && (txt[ lead ] & xxoooooo) == xooooooo; lead-- );
+
+    if( lead < i && (txt[ lead ] & xxoooooo) != xooooooo && lead + utf8meter( txt + lead, len - lead ) > i )
+      from = lead + utf8meter( txt + lead, len - lead );
+    else return i;
+  }
+
+  return len;
+}
+
+static int nextTrie( const struct RAPTOR *raptor, const char *txt, int i, const int len ){
+  const struct ENGINE *engine = raptor->engine;
+  const int           *trie   = engine->trie;
+  int                  best   = len;
+
+  for( int node = 0, chr, depth; i < len && i - engine->trieMax + 1 < best; i++ ){
+    if( node == 0 && (i = scanBits( engine->first, txt, i, len )) == len ) break;
+
+    chr = engine->trieFold ? toLower( (unsigned char)txt[ i ] ) : (unsigned char)txt[ i ];
+    while( node && childTrie( trie, node, chr ) == 0 ) node = TRIE_AT( trie, node )[ TRIE_FAIL ];
+    node = childTrie( trie, node, chr );
+    if( (depth = TRIE_AT( trie, node )[ TRIE_DEPTH ]) && i - depth + 1 < best ) best = i - depth + 1;
+  }
+
+  return best;
+}
+
+static int leadUtf8( const char *txt, const int i, const int len ){
+  int lead = i;
+  while( RAPTOR_UTF8 && lead > 0 && lead > i - 8 && (txt[ lead ] & xxoooooo) == xooooooo ) lead--;
+
+  if( lead < i && (txt[ lead ] & xxoooooo) != xooooooo && lead + utf8meter( txt + lead, len - lead ) > i )
+    return lead + utf8meter( txt + lead, len - lead );
+  return i;
+}
+
+static const char * memInner( const struct RAPTOR *raptor, const char *str, const int n ){
+  const struct ENGINE *engine = raptor->engine;
+  if( engine->innerLen >= INNER_SKIP ) return memSkip( str, n, engine->inner, engine->innerLen, engine->skip );
+  return memStr( str, n, engine->inner, engine->innerLen );
+}
+
+static int nextInner( const struct RAPTOR *raptor, const char *txt, int i, const int len, int *hit ){
+  const struct ENGINE *engine = raptor->engine;
+  while( i < len ){
+    if( i > *hit - engine->innerMin ){
+      const int   from = i + engine->innerMin;
+      const char *at   = from < len ? memInner( raptor, txt + from, len - from ) : 0;
+      if( at == 0 ) return len;
+      if( (*hit = at - txt) - engine->innerMax > i ) i = leadUtf8( txt, *hit - engine->innerMax, len );
+    }
+
+    if( engine->anyFirst || (i = nextFirst( engine->first, txt, i, len )) <= *hit - engine->innerMin ) return i;
+  }
+
+  return len;
+}
+
+static int nextOmega( const struct RAPTOR *raptor, const char *txt, const int i, const int len ){
+  const struct ENGINE *engine = raptor->engine;
+  int bound = len - engine->reach;
+
+  if( engine->backStates ){
+    const unsigned long long *back = engine->back, *follow = back + 256;
+    unsigned long long live = follow[ 0 ];
+    int least = live & 1 ? len : -1;
+
+    for( int p = len; p > i && live; ){
+      unsigned long long at = live & back[ (unsigned char)txt[ --p ] ];
+      for( int q = live = 0; at; q++, at >>= 1 )
+        if( at & 1 ) live |= follow[ q ];
+
+      if( live & 1 ) least = p;
+    }
+
+    if( least < 0 ) return len;
+    if( least - engine->backHead > bound ) bound = least - engine->backHead;
+  }
+
+  if( bound <= i ) return i;
+  return raptor->mods & MOD_ALPHA || bound >= len ? len : leadUtf8( txt, bound, len );
+}
+
+static int boundRaptor( const char *re, const int len, int *sets, int *ranges ){
+  int wides = 0, fold = FALSE;
+
+  *sets = 0;
+  for( int i = 0; i < len; i++ ){
+    if( re[ i ] == '[' || re[ i ] == ':' || re[ i ] == '.' ) (*sets)++;
+    if( re[ i ] & xooooooo ) wides++;
+    if( re[ i ] == '#' ) fold = TRUE;
+  }
+
+  *ranges = *sets + 2 * wides;
+  if( RAPTOR_UTF8 && fold && wides ) return 0;
+  return sizeof( struct ENGINE ) + (4 * len + 1) * sizeof( struct TABLE ) + *ranges * sizeof( unsigned long long ) + *sets * 32 + len;
+}
+
+int shotRaptor( struct CONTEXT *ctx, const char *txt, const char *re ){
+  int                sets, ranges, size, result;
+  const int          len   = strLen( re ), bound = boundRaptor( re, len, &sets, &ranges );
+  unsigned long long mem[ SHOT_SIZE / sizeof( unsigned long long ) ];
+  struct ARENA       arena = { (char *)mem, sizeof mem, 0, NIL };
+  struct RAPTOR      raptor;
+
+  initCatchCtx( ctx, NIL );
+  if( bound && bound <= SHOT_SIZE ){
+    placeRaptor( &raptor, (struct ENGINE *)mem, 4 * len + 1, 0, ranges, sets, 0 );
+    fillRaptor ( &raptor, re, len, TRUE );
+  } else {
+    if( (size = sizeRaptor( re, len )) > SHOT_SIZE && (arena.mem = malloc( arena.size = size )) == NIL ) return 0;
+    buildRaptor( &raptor, &arena, re, len, TRUE );
+  }
+
+  result = matchRaptor( ctx, &raptor, txt, strLen( txt ) );
+  if( arena.mem != (char *)mem ) free( arena.mem );
+  return result;
+}
+
+#ifndef REGEXP4_BOTH
+static struct CONTEXT context;
+
+int regexp4( const char *txt, const char *re ){
+  return shotRaptor( &context, txt, re );
+}
+#endif
+
+static void initContext( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len ){
+  const struct ENGINE *engine = raptor->engine;
+  ctx->table        = raptor->table;
+  ctx->sets         = engine->sets;
+  ctx->ranges       = engine->ranges;
+  ctx->pool         = engine->pool;
+  ctx->text.ptr     = txt;
+  ctx->text.pos     = 0;
+  ctx->text.len     = len;
+  ctx->Catch.index  = 1;
+  startCatch( ctx );
+  ctx->Catch.slot[0].ptr = txt;
+  ctx->Catch.slot[0].len = len;
+  ctx->Catch.slot[0].id  = 0;
+}
+
+static int startMatch( struct CONTEXT *ctx, const struct RAPTOR *raptor, struct TRACK *stack, const int i ){
+  const int oCindex = ctx->Catch.index;
+  ctx->Catch.idx    = 1;
+  ctx->Catch.mute   = raptor->engine->probe;
+  ctx->text.pos     = 0;
+  ctx->text.ptr     = ctx->Catch.slot[0].ptr + i;
+  ctx->text.len     = ctx->Catch.slot[0].len - i;
+
+  if( trekking( ctx, stack ) ){
+    if( !(raptor->mods & MOD_OMEGA) || ctx->text.pos == ctx->text.len ) return TRUE;
+    ctx->Catch.index = 1;
+  } else ctx->Catch.index = oCindex;
+
+  return FALSE;
+}
+
+static int catchMatch( struct CONTEXT *ctx, struct TRACK *stack, const int i ){
+  ctx->Catch.mute = FALSE;
+  ctx->Catch.idx  = 1;
+  ctx->text.pos   = 0;
+  trekking( ctx, stack );
+  return i;
+}
+
+static int nextMatch( struct CONTEXT *ctx, const struct RAPTOR *raptor, struct TRACK *stack, int i, const int stop ){
+  const struct ENGINE *engine = raptor->engine;
+  const char *txt = ctx->Catch.slot[0].ptr;
+  int         hit = -1;
+
+  if( raptor->mods & MOD_OMEGA ) i = nextOmega( raptor, txt, i, ctx->Catch.slot[0].len );
+  for( int loops = raptor->mods & MOD_ALPHA ? 1 : stop; i < loops; i += meterCtx( ctx, txt + i, ctx->Catch.slot[0].len - i ) ){
+    if( engine->prefixLen ){
+      const char *hit = memStr( txt + i, ctx->Catch.slot[0].len - i, engine->prefix, engine->prefixLen );
+      if( (i = hit ? hit - txt : ctx->Catch.slot[0].len) >= loops ) break;
+    } else if( engine->nodes ){
+      if( (i = nextTrie( raptor, txt, i, ctx->Catch.slot[0].len )) >= loops ) break;
+    } else if( engine->innerLen ){
+      if( (i = nextInner( raptor, txt, i, ctx->Catch.slot[0].len, &hit )) >= loops ) break;
+    } else if( !engine->anyFirst && (i = nextFirst( engine->first, txt, i, loops )) >= loops ) break;
+
+    if( startMatch( ctx, raptor, stack, i ) ) return engine->probe ? catchMatch( ctx, stack, i ) : i;
+  }
+
+  return raptor->mods & MOD_ALPHA ? ctx->Catch.slot[0].len : i;
+}
+
+static int forwardMatch( struct CONTEXT *ctx, const struct RAPTOR *raptor, const int i ){
+  const char *txt = ctx->Catch.slot[0].ptr;
+
+  if( (raptor->mods & MOD_FwrByChar) || ctx->text.pos == 0 ) return meterCtx( ctx, txt + i, ctx->Catch.slot[0].len - i );
+  return ctx->text.pos;
+}
+
+static int stepDfa( const struct RAPTOR *raptor, const int thread, const int chr, int *caps, const int pos ){
+  for( int index = thread >> 8, n = thread & 255; ; index = afterDfa( raptor, index ), n = 0 ){
+    const struct TABLE *entry = &raptor->table[ index ];
+    switch( entry->command ){
+    case COM_PATH_ELE: case COM_PATH_END: case COM_END: return DFA_DONE;
+    case COM_HOOK_INI: if( caps ) caps[ 2 * entry->arg     ] = pos; continue;
+    case COM_HOOK_END: if( caps ) caps[ 2 * entry->arg + 1 ] = pos; continue;
+    default          : break;
+    }
+
+    if( isText( entry ) ){
+      if( n == entry->chr ) continue;
+      return memberDfa( raptor, index, n, chr ) ? (index << 8) + n + 1 : DFA_DEAD;
+    }
+
+    if( n < maxLoops( entry ) && memberDfa( raptor, index, 0, chr ) )
+      return (index << 8) + (entry->loopsMax == MAX_LOOPS && n == entry->loopsMin ? n : n + 1);
+    if( n < entry->loopsMin ) return DFA_DEAD;
+  }
+}
+
+static int endDfa( const struct RAPTOR *raptor, const int thread, int *caps, const int pos ){
+  for( int index = thread >> 8, n = thread & 255; ; index = afterDfa( raptor, index ), n = 0 ){
+    const struct TABLE *entry = &raptor->table[ index ];
+    switch( entry->command ){
+    case COM_PATH_ELE: case COM_PATH_END: case COM_END: return TRUE;
+    case COM_HOOK_INI: if( caps ) caps[ 2 * entry->arg     ] = pos; continue;
+    case COM_HOOK_END: if( caps ) caps[ 2 * entry->arg + 1 ] = pos; continue;
+    default          : break;
+    }
+
+    if( n < (isText( entry ) ? entry->chr : entry->loopsMin) ) return FALSE;
+  }
+}
+
+static int addDfa( struct DFA *dfa, const int pending, const int *list, const int count ){
+  int *rec = dfa->mem + dfa->used;
+  rec[ DFA_PENDING ] = pending;
+  rec[ DFA_COUNT   ] = count;
+  for( int i = 0; i < dfa->classes; i++ ) rec[ DFA_STEPS + i ] = -1;
+  for( int i = 0; i < count; i++ ) rec[ DFA_STEPS + dfa->classes + i ] = list[ i ];
+
+  dfa->used += dfa->rec;
+  return rec - dfa->mem;
+}
+
+static int stateDfa( struct DFA *dfa, const int pending, const int *list, const int count ){
+  for( int state = 0, i; state < dfa->used; state += dfa->rec ){
+    const int *rec = dfa->mem + state;
+    if( rec[ DFA_PENDING ] != pending || rec[ DFA_COUNT ] != count ) continue;
+
+    for( i = 0; i < count && rec[ DFA_STEPS + dfa->classes + i ] == list[ i ]; i++ );
+    if( i == count ) return state;
+  }
+
+  if( dfa->used + dfa->rec > dfa->size ){
+    dfa->used = 0;
+    dfa->flushes++;
+    addDfa( dfa, FALSE, NIL, 0 );
+    if( pending == FALSE && count == 0 ) return 0;
+  }
+
+  return addDfa( dfa, pending, list, count );
+}
+
+static int nextDfa( struct DFA *dfa, const struct RAPTOR *raptor, const int state, const int chr ){
+  const int *threads = dfa->mem + state + DFA_STEPS + dfa->classes, pending = dfa->mem[ state + DFA_PENDING ], count = dfa->mem[ state + DFA_COUNT ];
+  const int  total   = count + (pending || raptor->mods & MOD_ALPHA ? 0 : dfa->nStarts), flushes = dfa->flushes;
+  int list[ DFA_POSITIONS ], size = 0, event = FALSE, next;
+
+  for( int i = 0, j; i < total && !event; i++ ){
+    next = stepDfa( raptor, i < count ? threads[ i ] : dfa->starts[ i - count ], chr, NIL, 0 );
+    if( next == DFA_DONE ) event = !(raptor->mods & MOD_OMEGA);
+    else if( next != DFA_DEAD ){
+      for( j = 0; j < size && list[ j ] != next; j++ );
+      if( j == size ) list[ size++ ] = next;
+    }
+  }
+
+  next = stateDfa( dfa, pending || event, list, size ) << 2 | (size == 0) << 1 | event;
+  if( flushes == dfa->flushes ) dfa->mem[ state + DFA_STEPS + raptor->engine->classes[ chr ] ] = next;
+  return next;
+}
+
+static int skipDfa( const struct RAPTOR *raptor, const char *txt, const int i, const int len, int *hit ){
+  const struct ENGINE *engine = raptor->engine;
+  if( engine->prefixLen ){
+    const char *hit = memStr( txt + i, len - i, engine->prefix, engine->prefixLen );
+    return hit ? hit - txt : len;
+  }
+
+  if( engine->nodes ) return nextTrie( raptor, txt, i, len );
+  if( engine->innerLen ) return nextInner( raptor, txt, i, len, hit );
+  return engine->anyFirst ? i : nextFirst( engine->first, txt, i, len );
+}
+
+static int runAscii( const struct RAPTOR *raptor, const char *txt, const int i, const int len, const int least ){
+  int end;
+  if( !RAPTOR_UTF8 || !raptor->engine->wide ) return len;
+
+  end = spanAscii( txt, i, len - i > ASCII_SPAN ? i + ASCII_SPAN : len );
+  return end == len || end - i >= least ? end : i;
+}
+
+static int nextRun( const struct RAPTOR *raptor, const char *txt, int i, const int len ){
+  for( i = spanAscii( txt, i, len ); i < len && runAscii( raptor, txt, i, len, ASCII_RUN ) == i; )
+    i = txt[ i ] & 0x80 ? i + 1 : spanAscii( txt, i, len );
+  return i;
+}
+
+static int sizePike( const struct RAPTOR *raptor ){
+  const struct ENGINE *engine = raptor->engine;
+  return raptor->index + engine->positions * engine->classCount + (4 * engine->positions + 1) * PIKE_REC( engine->hooks );
+}
+
+static int fitPike( const struct CONTEXT *ctx, const struct RAPTOR *raptor ){
+  return raptor->engine->positions && ctx->cacheSize >= sizePike( raptor );
+}
+
+static int fitDfa( const struct CONTEXT *ctx, const struct RAPTOR *raptor ){
+  const struct ENGINE *engine = raptor->engine;
+  return engine->positions && ctx->cacheSize >= (engine->hooks ? sizePike( raptor ) : 0) + 3 * (DFA_STEPS + engine->classCount + engine->positions);
+}
+
+static void initPike( struct CONTEXT *ctx, const struct RAPTOR *raptor ){
+  const struct ENGINE *engine = raptor->engine;
+  int *base = ctx->cache + PIKE_REC( engine->hooks ), *steps = base + raptor->index;
+  for( int index = 0, slots = 0; index < raptor->index; index++ ){
+    const struct TABLE *entry = &raptor->table[ index ];
+    switch( entry->command ){
+    case COM_SET_INI: case COM_META: case COM_POINT: case COM_SIMPLE: case COM_UTF8:
+      base[ index ] = slots;
+      slots        += slotsDfa( entry );
+      index         = entry->close;
+      break;
+    default: base[ index ] = 0; break;
+    }
+  }
+
+  for( int i = 0; i < engine->positions * engine->classCount; i++ ) steps[ i ] = DFA_UNSEEN;
+}
+
+static void hookPike( const struct RAPTOR *raptor, int *thread, int index, const int last, const int pos ){
+  for( ; index < last; index++ )
+    switch( raptor->table[ index ].command ){
+    case COM_HOOK_INI: thread[ PIKE_HOOKS + 2 * raptor->table[ index ].arg     ] = pos; break;
+    case COM_HOOK_END: thread[ PIKE_HOOKS + 2 * raptor->table[ index ].arg + 1 ] = pos; break;
+    case COM_PATH_ELE: case COM_PATH_END: case COM_END: return;
+    default          : break;
+    }
+}
+
+static int stepPike( const struct CONTEXT *ctx, const struct RAPTOR *raptor, int *thread, const int chr, const int pos ){
+  const struct ENGINE *engine = raptor->engine;
+  const int            state  = thread[ PIKE_STATE ];
+  const int           *base   = ctx->cache + PIKE_REC( engine->hooks );
+  int                 *step   = ctx->cache + PIKE_REC( engine->hooks ) + raptor->index +
+                                (base[ state >> 8 ] + (state & 255)) * engine->classCount + engine->classes[ chr ];
+  if( *step == DFA_UNSEEN ) *step = stepDfa( raptor, state, chr, NIL, 0 );
+  if( *step != DFA_DEAD && engine->hooks )
+    hookPike( raptor, thread, state >> 8, *step == DFA_DONE ? raptor->index : *step >> 8, pos );
+  return *step;
+}
+
+static int seedPike( const struct RAPTOR *raptor, int *list, const int rec, const int count, const int index, const int pos ){
+  int *thread = list + count * rec, leaf = index;
+  while( raptor->table[ leaf ].command == COM_HOOK_INI || raptor->table[ leaf ].command == COM_HOOK_END ) leaf++;
+  hookPike( raptor, thread, index, leaf, pos );
+  thread[ PIKE_STATE ] = leaf << 8;
+  thread[ PIKE_START ] = pos;
+  thread[ PIKE_PATH  ] = index;
+  return count + 1;
+}
+
+static int scanPike( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len, int p, int stop, int *end ){
+  const struct ENGINE *engine = raptor->engine;
+  const int            rec    = PIKE_REC( engine->hooks );
+  int                 *best   = ctx->cache, *list = best + rec + raptor->index + engine->positions * engine->classCount;
+  int                 *next   = list + 2 * engine->positions * rec, *swap;
+  int                  count  = 0, start = len, hit = -1;
+
+  if( raptor->mods & MOD_OMEGA && (p = nextOmega( raptor, txt, p, len )) == len ) return len;
+
+  for( ;; p++ ){
+    if( count == 0 && start == len && (raptor->mods & MOD_ALPHA ? p > 0 : (p = skipDfa( raptor, txt, p, len, &hit )) == len) ) return len;
+    if( p >= stop && p < len && (txt[ p ] & 0x80 || (stop = runAscii( raptor, txt, p, len, p > stop ? ASCII_RUN : 0 )) == p) ){
+      for( int i = 0; i < count; i++ )
+        if( list[ i * rec + PIKE_START ] < start ) start = list[ i * rec + PIKE_START ];
+      *end = -1;
+      return start < len ? start : p;
+    }
+
+    if( start == len && p < len && (p == 0 || !(raptor->mods & MOD_ALPHA)) && (engine->anyFirst || getBit( engine->first, txt[ p ] )) ){
+      if( raptor->table[ 0 ].command != COM_PATH_INI ) count = seedPike( raptor, list, rec, count, 0, p );
+      else for( int i = 1; raptor->table[ i ].command == COM_PATH_ELE; i = raptor->table[ i ].close )
+        count = seedPike( raptor, list, rec, count, i + 1, p );
+    }
+
+    if( p == len ){
+      for( int i = 0; i < count; i++ )
+        if( endDfa( raptor, list[ i * rec + PIKE_STATE ], list + i * rec + PIKE_HOOKS, len ) ){
+          for( int k = 0; k < rec; k++ ) best[ k ] = list[ i * rec + k ];
+          *end = len;
+          return best[ PIKE_START ];
+        }
+
+      return start;
+    }
+
+    int size = 0;
+    for( int i = 0, j, step; i < count; i++ ){
+      int *thread = list + i * rec;
+      if( (step = stepPike( ctx, raptor, thread, (unsigned char)txt[ p ], p )) == DFA_DEAD ) continue;
+      if( step == DFA_DONE && raptor->mods & MOD_OMEGA ) continue;
+      if( step == DFA_DONE ){
+        for( int k = 0; k < rec; k++ ) best[ k ] = thread[ k ];
+        start = best[ PIKE_START ];
+        *end  = p;
+        break;
+      }
+
+      for( j = 0; j < size && next[ j * rec + PIKE_STATE ] != step; j++ );
+      if( j < size ) continue;
+
+      for( int k = 0; k < rec; k++ ) next[ size * rec + k ] = thread[ k ];
+      next[ size++ * rec + PIKE_STATE ] = step;
+    }
+
+    swap  = list;
+    list  = next;
+    next  = swap;
+    count = size;
+    if( start < len && count == 0 ) return start;
+  }
+}
+
+static void catchPike( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int end ){
+  const int *best  = ctx->cache;
+  ctx->Catch.mute  = FALSE;
+  ctx->Catch.idx   = 1;
+  ctx->text.ptr    = txt;
+
+  for( int index = best[ PIKE_PATH ], slot; raptor->table[ index ].command != COM_PATH_ELE &&
+         raptor->table[ index ].command != COM_PATH_END && raptor->table[ index ].command != COM_END; index++ )
+    if( raptor->table[ index ].command == COM_HOOK_INI ){
+      ctx->text.pos = best[ PIKE_HOOKS + 2 * raptor->table[ index ].arg     ];
+      openCatch( ctx, &slot );
+      ctx->text.pos = best[ PIKE_HOOKS + 2 * raptor->table[ index ].arg + 1 ];
+      closeCatch( ctx, slot );
+    }
+
+  ctx->text.ptr = txt + best[ PIKE_START ];
+  ctx->text.pos = end - best[ PIKE_START ];
+  ctx->text.len = ctx->Catch.slot[ 0 ].len - best[ PIKE_START ];
+}
+
+static int nextPike( struct CONTEXT *ctx, const struct RAPTOR *raptor, struct TRACK *stack, int i ){
+  const char *txt = ctx->Catch.slot[0].ptr;
+  const int   len = ctx->Catch.slot[0].len;
+
+  for( int stop, end, run; i < len; ){
+    if( (stop = runAscii( raptor, txt, i, len, ASCII_RUN )) > i && (i = scanPike( ctx, raptor, txt, len, i, stop, &end )) < len && end >= 0 ){
+      catchPike( ctx, raptor, txt, end );
+      return i;
+    }
+
+    if( i == len ) break;
+    run = nextRun( raptor, txt, i, len );
+    if( (i = nextMatch( ctx, raptor, stack, i, run )) < run ) return i;
+  }
+
+  return len;
+}
+
+static int scanDfa( struct CONTEXT *ctx, const struct RAPTOR *raptor, struct TRACK *stack, const char *txt, const int len ){
+  const struct ENGINE *engine = raptor->engine;
+  const int            skip   = engine->hooks ? sizePike( raptor ) : 0;
+  int                  starts[ DFA_POSITIONS ], result = 0, p = 0, from = 0, end = 0, stop, run, hit = -1, state, code, idle = !(raptor->mods & MOD_ALPHA);
+  struct DFA           dfa    = { ctx->cache + skip, ctx->cacheSize - skip, 0, DFA_STEPS + engine->classCount + engine->positions, engine->classCount, 0, starts, 0 };
+
+  if( raptor->table[ 0 ].command != COM_PATH_INI ) starts[ dfa.nStarts++ ] = 0;
+  else for( int i = 1; raptor->table[ i ].command == COM_PATH_ELE; i = raptor->table[ i ].close )
+    starts[ dfa.nStarts++ ] = (i + 1) << 8;
+
+  state = addDfa( &dfa, FALSE, NIL, 0 );
+  if( raptor->mods & MOD_ALPHA ) state = stateDfa( &dfa, FALSE, starts, dfa.nStarts );
+  if( raptor->mods & MOD_OMEGA && (p = nextOmega( raptor, txt, 0, len )) == len ) return result;
+
+  for( ;; ){
+    if( idle && (p = from = skipDfa( raptor, txt, p, len, &hit )) == len ) return result;
+
+    for( idle = FALSE, stop = runAscii( raptor, txt, p, len, ASCII_RUN ); ; stop = runAscii( raptor, txt, stop, len, 0 ) ){
+      for( ; p < stop; p++ ){
+        if( (code = dfa.mem[ state + DFA_STEPS + engine->classes[ (unsigned char)txt[ p ] ] ]) < 0 )
+          code = nextDfa( &dfa, raptor, state, (unsigned char)txt[ p ] );
+
+        state = code >> 2;
+        if( code & 1 ) end = p;
+        if( code & 2 ) break;
+      }
+
+      if( p < stop || stop == len || stop == from || txt[ stop ] & 0x80 ) break;
+    }
+
+    if( p < stop ){
+      p++;
+      if( dfa.mem[ state + DFA_PENDING ] == FALSE ){
+        if( raptor->mods & MOD_ALPHA ) return result;
+        idle = TRUE;
+        continue;
+      }
+    } else if( stop < len ){
+      state = 0;
+      idle  = TRUE;
+      run = nextRun( raptor, txt, from, len );
+      if( (p = nextMatch( ctx, raptor, stack, from, run )) >= run ) continue;
+      if( result++, raptor->mods & (MOD_ALPHA | MOD_OMEGA | MOD_LONLEY) ) return result;
+      p += forwardMatch( ctx, raptor, p );
+      continue;
+    } else {
+      int i = 0;
+      while( i < dfa.mem[ state + DFA_COUNT ] && !endDfa( raptor, dfa.mem[ state + DFA_STEPS + dfa.classes + i ], NIL, 0 ) ) i++;
+      if( i < dfa.mem[ state + DFA_COUNT ] ) end = len;
+      else if( dfa.mem[ state + DFA_PENDING ] == FALSE ) return result;
+    }
+
+    if( engine->hooks ){
+      scanPike( ctx, raptor, txt, len, from, stop, &end );
+      catchPike( ctx, raptor, txt, end );
+    }
+
+    if( result++, raptor->mods & (MOD_ALPHA | MOD_LONLEY) ) return result;
+    p     = end;
+    state = 0;
+    idle  = TRUE;
+  }
+}
+
+int matchRaptor( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len ){
+  const struct ENGINE *engine = raptor->engine;
+  struct TRACK         local[ ctx->stackMax < raptor->depth ? raptor->depth : 1 ];
+  struct TRACK        *stack  = ctx->stackMax < raptor->depth ? local : ctx->stack;
+  int result = 0;
+
+  initContext( ctx, raptor, txt, len );
+
+  if( len && raptor->index && fitDfa( ctx, raptor ) ){
+    if( engine->hooks ) initPike( ctx, raptor );
+    result = scanDfa( ctx, raptor, stack, txt, len );
+  } else if( len && raptor->index && engine->hooks && fitPike( ctx, raptor ) ){
+    initPike( ctx, raptor );
+    for( int i = 0; (i = nextPike( ctx, raptor, stack, i )) < len; i += forwardMatch( ctx, raptor, i ) )
+      if( result++, raptor->mods & (MOD_ALPHA | MOD_OMEGA | MOD_LONLEY) ) break;
+  } else if( len && raptor->index )
+    for( int i = 0; (i = nextMatch( ctx, raptor, stack, i, len )) < len; i += forwardMatch( ctx, raptor, i ) )
+      if( result++, raptor->mods & (MOD_OMEGA | MOD_LONLEY) ) break;
+
+  endCatch( ctx );
+  return result;
+}
+
+int findRaptor( struct CONTEXT *ctx, const struct RAPTOR *raptor, const char *txt, const int len, int *offset ){
+  struct TRACK  local[ ctx->stackMax < raptor->depth ? raptor->depth : 1 ];
+  struct TRACK *stack = ctx->stackMax < raptor->depth ? local : ctx->stack;
+  int i = *offset;
+
+  initContext( ctx, raptor, txt, len );
+
+  if( i < 0 || i >= len || raptor->index == 0 ) i = len;
+  else if( !fitPike( ctx, raptor ) ) i = nextMatch( ctx, raptor, stack, i, len );
+  else {
+    initPike( ctx, raptor );
+    i = nextPike( ctx, raptor, stack, i );
+  }
+
+  if( i >= len ){
+    *offset = len;
+    endCatch( ctx );
+    return FALSE;
+  }
+
+  if( raptor->mods & (MOD_ALPHA | MOD_OMEGA | MOD_LONLEY) ) *offset = len;
+  else *offset = i + forwardMatch( ctx, raptor, i );
+
+  endCatch( ctx );
+  return TRUE;
+}
+
+static int tryPack( struct CONTEXT *ctx, const struct RAPTOR *raptor, struct TRACK *stack, const int p ){
+  const struct ENGINE *engine = raptor->engine;
+  if( p && raptor->mods & MOD_ALPHA ) return FALSE;
+  if( engine->prefixLen && (ctx->Catch.slot[0].len - p < engine->prefixLen ||
+                            !memEql( ctx->Catch.slot[0].ptr + p, engine->prefix, engine->prefixLen )) ) return FALSE;
+
+  ctx->table  = raptor->table;
+  ctx->sets   = engine->sets;
+  ctx->ranges = engine->ranges;
+  ctx->pool   = engine->pool;
+  if( !startMatch( ctx, raptor, stack, p ) ) return FALSE;
+
+  ctx->Catch.index = 1;
+  return TRUE;
+}
+
+int matchPack( struct CONTEXT *ctx, const struct PACK *pack, const char *txt, const int len, int *at ){
+  struct TRACK  local[ ctx->stackMax < pack->depth ? pack->depth : 1 ];
+  struct TRACK *stack = ctx->stackMax < pack->depth ? local : ctx->stack;
+  int result = 0;
+
+  for( int id = 0; id < pack->count; id++ ) at[ id ] = -1;
+  if( pack->count == 0 ) return 0;
+
+  initContext( ctx, pack->raptor, txt, len );
+  for( int p = 0; p < len && result < pack->count; p += meterCtx( ctx, txt + p, len - p ) ){
+    if( !pack->anyFirst && (p = nextFirst( pack->first, txt, p, len )) >= len ) break;
+
+    for( int w = 0; w < pack->words; w++ )
+      for( unsigned bits = pack->bucket[ (unsigned char)txt[ p ] * pack->words + w ], id = w * 32; bits; bits >>= 1, id++ )
+        if( bits & 1 && at[ id ] < 0 && tryPack( ctx, &pack->raptor[ id ], stack, p ) ){
+          at[ id ] = p;
+          result++;
+        }
+  }
+
+  ctx->Catch.mute = FALSE;
+  endCatch( ctx );
+  return result;
+}
+
+static int maxLoops( const struct TABLE *entry ){
+  return entry->loopsMax == MAX_LOOPS ? INF : entry->loopsMax;
+}
+
+#if defined( THREADED ) && defined( __GNUC__ )
+#define OP( label ) label:
+#define NEXT        goto *commands[ table[ index ].command ]
+#else
+#define OP( label )
+#define NEXT        goto next
+#endif
+
+static int trekking( struct CONTEXT *ctx, struct TRACK *stack ){
+#if defined( THREADED ) && defined( __GNUC__ )
+  static const void *const commands[] = {
+    [ COM_PATH_INI  ] = &&path,  [ COM_PATH_ELE  ] = &&end,  [ COM_PATH_END ] = &&end,
+    [ COM_GROUP_INI ] = &&group, [ COM_GROUP_END ] = &&end,
+    [ COM_HOOK_INI  ] = &&group, [ COM_HOOK_END  ] = &&end,
+    [ COM_SET_INI   ] = &&leaf,  [ COM_SET_END   ] = &&end,
+    [ COM_BACKREF   ] = &&leaf,  [ COM_META      ] = &&leaf, [ COM_RANGEAB  ] = &&leaf,
+    [ COM_UTF8      ] = &&leaf,  [ COM_POINT     ] = &&leaf, [ COM_SIMPLE   ] = &&leaf,
+    [ COM_END       ] = &&end };
+#endif
+  const struct TABLE *table = ctx->table;
+  struct TRACK       *track;
+  int                 index = 0, top = 0, result;
+
+ next:
+  switch( table[ index ].command ){
+  case COM_PATH_INI :
+  OP( path )
+    track         = &stack[ top++ ];
+    track->index  = index;
+    track->count  = index + 1;
+    track->pos    = ctx->text.pos;
+    track->cIndex = ctx->Catch.index;
+    track->cIdx   = ctx->Catch.idx;
+    goto alternative;
+  case COM_GROUP_INI:
+  case COM_HOOK_INI :
+  OP( group )
+    track         = &stack[ top++ ];
+    track->index  = index;
+    track->count  = 0;
+    if( table[ index ].command == COM_HOOK_INI ) openCatch( ctx, &track->cIndex );
+    if( table[ index ].loopsMax == 0 ) goto looped;
+
+    index++;
+    NEXT;
+  case COM_SET_INI  : case COM_BACKREF: case COM_META  : case COM_RANGEAB:
+  case COM_UTF8     : case COM_POINT  : case COM_SIMPLE:
+  OP( leaf )
+    if( !looper( ctx, index ) ){
+      result = FALSE;
+      goto back;
+    }
+
+    index = table[ index ].close + 1;
+    NEXT;
+  default           :
+  OP( end )
+    result = TRUE;
+  }
+
+ back:
+  if( top == 0 ) return result;
+
+  track = &stack[ top - 1 ];
+  if( table[ track->index ].command != COM_PATH_INI ) goto loop;
+  if( result ){
+    index = table[ track->index ].close + 1;
+    top--;
+    NEXT;
+  }
+
+  ctx->text.pos    = track->pos;
+  ctx->Catch.index = track->cIndex;
+  ctx->Catch.idx   = track->cIdx;
+  track->count     = table[ track->count ].close;
+ alternative:
+  if( table[ track->count ].command == COM_PATH_ELE ){
+    index = track->count + 1;
+    NEXT;
+  }
+
+  top--;
+  result = FALSE;
+  goto back;
+
+ loop:
+  if( result && ++track->count < maxLoops( &table[ track->index ] ) ){
+    index = track->index + 1;
+    NEXT;
+  }
+ looped:
+  result = track->count >= table[ track->index ].loopsMin;
+  if( result && table[ track->index ].command == COM_HOOK_INI ) closeCatch( ctx, track->cIndex );
+
+  index = table[ track->index ].close + 1;
+  top--;
+  if( result ) goto next;
+  goto back;
+}
+
+#undef OP
+#undef NEXT
+
+static int looper( struct CONTEXT *ctx, const int index ){
+  const struct TABLE *entry = &ctx->table[ index ];
+  const char         *hit, *txt = ctx->text.ptr;
+  const int           max   = maxLoops( entry );
+  int steps, end, loops = 0;
+
+  switch( entry->run ){
+  case RUN_POINT:
+  case RUN_SET  :
+    while( loops < max && ctx->text.pos < ctx->text.len ){
+      end            = ctx->text.len - ctx->text.pos < max - loops ? ctx->text.len : ctx->text.pos + max - loops;
+      if( entry->run == RUN_SET ) end = spanBits( ctx->sets[ entry->arg ], txt, ctx->text.pos, end );
+      else if( RAPTOR_UTF8 )      end = spanAscii( txt, ctx->text.pos, end );
+      loops         += end - ctx->text.pos;
+      ctx->text.pos  = end;
+      if( !RAPTOR_UTF8 || loops == max || end == ctx->text.len || !(txt[ end ] & xooooooo) || !(steps = match( ctx, index )) ) break;
+
+      ctx->text.pos += steps;
+      loops++;
+    }
+    break;
+  case RUN_NOT  :
+    end   = ctx->text.len - ctx->text.pos < max ? ctx->text.len : ctx->text.pos + max;
+    if( (hit = memChr( txt + ctx->text.pos, entry->chr, end - ctx->text.pos )) ) end = hit - txt;
+    loops = end - ctx->text.pos; ctx->text.pos = end; break;
+  case RUN_BYTE :
+    end   = ctx->text.len - ctx->text.pos < max ? ctx->text.len : ctx->text.pos + max;
+    if( entry->mods & MOD_COMMUNISM ) end = spanChrCommunist( txt, ctx->text.pos, end, ctx->pool[ entry->arg ] );
+    else                              end = spanChr         ( txt, ctx->text.pos, end, ctx->pool[ entry->arg ] );
+    loops = end - ctx->text.pos; ctx->text.pos = end; break;
+  case RUN_TEXT :
+    while( loops < max && ctx->text.pos + entry->chr <= ctx->text.len &&
+           memEql( txt + ctx->text.pos, ctx->pool + entry->arg, entry->chr ) ){
+      ctx->text.pos += entry->chr;
+      loops++;
+    }
+    break;
+  default       :
+    while( loops < max && ctx->text.pos < ctx->text.len && (steps = match( ctx, index )) ){
+      ctx->text.pos += steps;
+      loops++;
+    }
+  }
+
+  return loops < entry->loopsMin ? FALSE : TRUE;
+}
+
+static int match( struct CONTEXT *ctx, const int index ){
+  switch( ctx->table[ index ].command ){
+  case COM_POINT  : return meterCtx( ctx, ctx->text.ptr + ctx->text.pos, ctx->text.len - ctx->text.pos );
+  case COM_SET_INI: return matchSet    ( ctx, index );
+  case COM_BACKREF: return matchBackRef( ctx, index );
+  case COM_META   : return matchMeta   ( ctx, index, ctx->text.ptr + ctx->text.pos );
+  default         : return matchText   ( ctx, index, ctx->text.ptr + ctx->text.pos );
+  }
+}
+
+static int matchText( struct CONTEXT *ctx, const int index, const char *txt ){
+  const struct TABLE *entry = &ctx->table[ index ];
+  if( entry->chr > ctx->text.len - ctx->text.pos ) return 0;
+
+  if( isFold( entry ) )
+    return utf8meter( txt, entry->chr ) == entry->chr &&
+           foldCode( decodeUtf8( txt, entry->chr ) ) == decodeUtf8( ctx->pool + entry->arg, entry->chr ) ? entry->chr : 0;
+
+  if( entry->mods & MOD_COMMUNISM )
+    return    memEqlCommunist( txt, ctx->pool + entry->arg, entry->chr ) ? entry->chr : 0;
+  else return memEql         ( txt, ctx->pool + entry->arg, entry->chr ) ? entry->chr : 0;
+}
+
+static int matchMeta( struct CONTEXT *ctx, const int index, const char *txt ){
+  const int len = ctx->text.len - ctx->text.pos;
+  if( RAPTOR_UTF8 && *txt & xooooooo ) return matchClass( ctx->table[ index ].chr, txt, meterCtx( ctx, txt, len ) );
+
+  switch( ctx->table[ index ].chr ){
+  case 'a' : return  isAlpha( *txt );
+  case 'A' : return !isAlpha( *txt ) ? utf8meter( txt, len ) : FALSE;
+  case 'd' : return  isDigit( *txt );
+  case 'D' : return !isDigit( *txt ) ? utf8meter( txt, len ) : FALSE;
+  case 'w' : return  isAlnum( *txt );
+  case 'W' : return !isAlnum( *txt ) ? utf8meter( txt, len ) : FALSE;
+  case 's' : return  isSpace( *txt );
+  case 'S' : return !isSpace( *txt ) ? utf8meter( txt, len ) : FALSE;
+  case '&' : return RAPTOR_UTF8 ? (*txt & xooooooo ? utf8meter( txt, len ) : FALSE) : *txt == '&';
+  default  : return *txt == (char)ctx->table[ index ].chr;
+  }
+}
+
+static int matchClass( const int meta, const char *txt, const int width ){
+  const int kind = classCode( decodeUtf8( txt, width ) );
+  switch( meta ){
+  case 'a' : return  kind & UNI_ALPHA                ? width : FALSE;
+  case 'A' : return  kind & UNI_ALPHA                ? FALSE : width;
+  case 'd' : return  kind & UNI_DIGIT                ? width : FALSE;
+  case 'D' : return  kind & UNI_DIGIT                ? FALSE : width;
+  case 'w' : return  kind & (UNI_ALPHA | UNI_DIGIT)  ? width : FALSE;
+  case 'W' : return  kind & (UNI_ALPHA | UNI_DIGIT)  ? FALSE : width;
+  case 's' : return  kind & UNI_SPACE                ? width : FALSE;
+  case 'S' : return  kind & UNI_SPACE                ? FALSE : width;
+  case '&' : return  width;
+  default  : return *txt == (char)meta;
+  }
+}
+
+static int matchSet( struct CONTEXT *ctx, const int index ){
+  const char chr = ctx->text.ptr[ ctx->text.pos ];
+  if( RAPTOR_UTF8 && chr & xooooooo ) return matchWide( ctx, index );
+
+  return getBit( ctx->sets[ ctx->table[ index ].arg ], chr ) != 0;
+}
+
+static int matchWide( struct CONTEXT *ctx, const int index ){
+  const char *txt   = ctx->text.ptr + ctx->text.pos;
+  const int   width = meterCtx( ctx, txt, ctx->text.len - ctx->text.pos ), end = ctx->table[ index ].close;
+  const unsigned long long *range = ctx->ranges + ctx->table[ end ].arg;
+  const int   fold  = ctx->table[ index ].mods & MOD_COMMUNISM ? foldCode( decodeUtf8( txt, width ) ) : -1;
+  int found = findRange( range + 1, range[ 0 ], keyUtf8( txt, width ) );
+
+  if( !found && fold >= 0x80 ) found = findRange( range + 1, range[ 0 ], keyCode( fold ) );
+
+  for( int i = index + 1; !found && ctx->table[ end ].chr && i < end; i++ )
+    if( ctx->table[ i ].command == COM_META ) found = matchMeta( ctx, i, txt ) != 0;
+
+  return found != ((ctx->table[ index ].mods & MOD_NEGATIVE) != 0) ? width : FALSE;
+}
+
+static int matchBackRef( struct CONTEXT *ctx, const int index ){
+  const int backRefIndex = lastIdCatch( ctx, ctx->table[ index ].arg );
+  if( gpsCatchCtx( ctx, backRefIndex ) == NIL || lenCatchCtx( ctx, backRefIndex ) > ctx->text.len - ctx->text.pos ||
+      memEql( ctx->text.ptr + ctx->text.pos, gpsCatchCtx( ctx, backRefIndex ), lenCatchCtx( ctx, backRefIndex ) ) == FALSE )
+    return FALSE;
+  else return lenCatchCtx( ctx, backRefIndex );
+}
+
+static int lastIdCatch( struct CONTEXT *ctx, const int id ){
+  for( int index = ctx->Catch.index - 1; index > 0; index-- )
+    if( ctx->Catch.slot[ index ].id == id ) return index;
+
+  return 0;
+}
+
+static void openCatch( struct CONTEXT *ctx, int *index ){
+  if( ctx->Catch.mute ) *index = 0;
+  else if( ctx->Catch.index < ctx->Catch.max || growCatch( ctx ) ){
+    *index = ctx->Catch.index++;
+    ctx->Catch.slot[ *index ].ptr = ctx->text.ptr + ctx->text.pos;
+    ctx->Catch.slot[ *index ].id  = ctx->Catch.idx++;
+  } else {
+    *index          = 0;
+    ctx->Catch.over = TRUE;
+  }
+}
+
+static void closeCatch( struct CONTEXT *ctx, const int index ){
+  if( index )
+    ctx->Catch.slot[ index ].len = &ctx->text.ptr[ ctx->text.pos ] - ctx->Catch.slot[ index ].ptr;
+}
+
+static int growCatch( struct CONTEXT *ctx ){
+  struct ARENA *arena = ctx->Catch.arena;
+  const int     need  = ctx->Catch.base + (ctx->Catch.max + 1) * (int)sizeof( struct CAPTURE );
+
+  if( arena == NIL || ctx->Catch.slot == ctx->Catch.own || (need > arena->size && (arena->grow == NIL || !arena->grow( arena, need ))) )
+    return FALSE;
+
+  ctx->Catch.slot = (struct CAPTURE *)(arena->mem + ctx->Catch.base);
+  ctx->Catch.max  = (arena->size - ctx->Catch.base) / (int)sizeof( struct CAPTURE );
+  return TRUE;
+}
+
+static void startCatch( struct CONTEXT *ctx ){
+  ctx->Catch.over = FALSE;
+  ctx->Catch.mute = FALSE;
+  ctx->Catch.slot = ctx->Catch.own;
+  ctx->Catch.max  = MAX_CATCHS;
+
+  if( ctx->Catch.arena ){
+    ctx->Catch.slot = NIL;
+    ctx->Catch.max  = 0;
+    if( !growCatch( ctx ) ){
+      ctx->Catch.slot = ctx->Catch.own;
+      ctx->Catch.max  = MAX_CATCHS;
+    }
+  }
+}
+
+static void endCatch( struct CONTEXT *ctx ){
+  if( ctx->Catch.arena && ctx->Catch.slot != ctx->Catch.own )
+    ctx->Catch.arena->used = ctx->Catch.base + ctx->Catch.index * (int)sizeof( struct CAPTURE );
+}
+
+int validUtf8( const char *txt, const int len ){
+  return spanUtf8( txt, 0, len );
+}
+
+#ifndef REGEXP4_BOTH
+#include "regexp4_ctx.h"
+
+int          totCatch(){ return totCatchCtx( &context ); }
+const char * gpsCatch( const int index ){ return gpsCatchCtx( &context, index ); }
+int          lenCatch( const int index ){ return lenCatchCtx( &context, index ); }
+char *       cpyCatch( char *str, const int index ){ return cpyCatchCtx( &context, str, index ); }
+char *       rplCatch( char *newStr, const char *rplStr, const int id ){ return rplCatchCtx( &context, newStr, rplStr, id ); }
+char *       putCatch( char *newStr, const char *putStr ){ return putCatchCtx( &context, newStr, putStr ); }
+#endif
@@ -0,0 +1,105 @@
+#ifndef REGEXP4_CTX_H
+#define REGEXP4_CTX_H
+
+// the context functions do not depend on the encoding, regexp4_core.h
+// includes them for a single encoding and regexp4.c once for both
+
+const char * gpsMatchCtx( const struct CONTEXT *ctx ){ return ctx->text.ptr; }
+
+int lenMatchCtx( const struct CONTEXT *ctx ){ return ctx->text.pos; }
+
+void initCatchCtx( struct CONTEXT *ctx, struct ARENA *arena ){
+  const int align  = sizeof( const char * );
+  ctx->stack       = 0;
+  ctx->stackMax    = 0;
+  ctx->cache       = 0;
+  ctx->cacheSize   = 0;
+  ctx->trusted     = 0;
+  ctx->Catch.slot  = ctx->Catch.own;
+  ctx->Catch.max   = MAX_CATCHS;
+  ctx->Catch.over  = 0;
+  ctx->Catch.mute  = 0;
+  ctx->Catch.arena = arena;
+  ctx->Catch.base  = arena ? (arena->used + align - 1) / align * align : 0;
+  ctx->Catch.index = 0;
+}
+
+void initStackCtx( struct CONTEXT *ctx, struct TRACK *stack, const int max ){
+  ctx->stack    = stack;
+  ctx->stackMax = stack ? max : 0;
+}
+
+void initCacheCtx( struct CONTEXT *ctx, char *cache, const int size ){
+  const int skip = cache ? (int)(-(unsigned long)cache % sizeof( int )) : 0;
+  ctx->cache     = cache && size > skip ? (int *)(cache + skip) : 0;
+  ctx->cacheSize = ctx->cache ? (size - skip) / (int)sizeof( int ) : 0;
+}
+
+void initTrustCtx( struct CONTEXT *ctx, const int trusted ){
+  ctx->trusted = trusted;
+}
+
+int totCatchCtx( const struct CONTEXT *ctx ){ return ctx->Catch.index - 1; }
+
+int overCatchCtx( const struct CONTEXT *ctx ){ return ctx->Catch.over; }
+
+const char * gpsCatchCtx( const struct CONTEXT *ctx, const int index ){
+  return ( index > 0 && index < ctx->Catch.index ) ? ctx->Catch.slot[ index ].ptr : 0;
+}
+
+int lenCatchCtx( const struct CONTEXT *ctx, const int index ){
+  return ( index > 0 && index < ctx->Catch.index ) ? ctx->Catch.slot[ index ].len : 0;
+}
+
+char * cpyCatchCtx( const struct CONTEXT *ctx, char * str, const int index ){
+  const char *src = gpsCatchCtx( ctx, index );
+  char       *dst = str;
+
+  for( int n = lenCatchCtx( ctx, index ); n > 0; n-- ) *dst++ = *src++;
+  *dst = '\0';
+
+  return str;
+}
+
+char * rplCatchCtx( const struct CONTEXT *ctx, char * newStr, const char * rplStr, const int id ){
+  char *oNewStr = newStr;
+  const char *last = ctx->Catch.slot[ 0 ].ptr;
+
+  for( int index = 1; index < ctx->Catch.index; index++ )
+    if( id == ctx->Catch.slot[ index ].id ){
+      if( last > ctx->Catch.slot[index].ptr ) last = ctx->Catch.slot[index].ptr;
+
+      while( last < ctx->Catch.slot[index].ptr ) *newStr++ = *last++;
+      for( const char *rpl = rplStr; *rpl; ) *newStr++ = *rpl++;
+      last = ctx->Catch.slot[index].ptr + ctx->Catch.slot[index].len;
+    }
+
+  while( last < ctx->Catch.slot[0].ptr + ctx->Catch.slot[0].len ) *newStr++ = *last++;
+  *newStr = '\0';
+
+  return oNewStr;
+}
+
+char * putCatchCtx( const struct CONTEXT *ctx, char * newStr, const char * putStr ){
+  char *oNewStr = newStr;
+
+  while( *putStr )
+    switch( *putStr ){
+    case '#':
+      if( *++putStr == '#' )
+        *newStr++ = *putStr++;
+      else {
+        int index = 0;
+        while( *putStr >= '0' && *putStr <= '9' ) index = 10 * index + *putStr++ - '0';
+        cpyCatchCtx( ctx, newStr, index );
+        newStr += lenCatchCtx( ctx, index );
+      } break;
+    default : *newStr++ = *putStr++;
+    }
+
+  *newStr = '\0';
+
+  return oNewStr;
+}
+
+#endif
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# Writes unicodeTables.h from the Unicode data of this python:
+#   python3 unicodeTables.py > unicodeTables.h
+
+import unicodedata
+
+LEAF, MID = 5, 5
+
+def width( cp ):
+  return 1 if cp < 0x80 else 2 if cp < 0x800 else 3 if cp < 0x10000 else 4
+
+def fold( cp ):
+  if 0xD800 <= cp < 0xE000: return cp
+  for f in (chr( cp ).casefold(), chr( cp ).lower()):
+    if len( f ) == 1: return ord( f )
+  return cp
+
+def prop( cp ):
+  if cp < 0x80: return (0, 0)
+  c, kind = chr( cp ), unicodedata.category( chr( cp ) )
+  bits = (1 if kind[0] == 'L' else 0) | (2 if kind == 'Nd' else 0) | (4 if c.isspace() else 0)
+  f = fold( cp )
+  return (bits, f - cp if f != cp and f >= 0x80 and width( f ) == width( cp ) else 0)
+
+def stage( items, size ):
+  seen, index, table = {}, [], []
+  for i in range( 0, len( items ), size ):
+    block = tuple( items[ i : i + size ] )
+    if block not in seen:
+      seen[ block ] = len( seen )
+      table.extend( block )
+    index.append( seen[ block ] )
+  return index, table
+
+def array( kind, name, values ):
+  rows = [ ", ".join( "%d" % v for v in values[ i : i + 24 ] ) for i in range( 0, len( values ), 24 ) ]
+  return "static const %s %s[ %d ] = {\n  %s\n};\n" % (kind, name, len( values ), ",\n  ".join( rows ))
+
+props, leaf = {}, []
+for cp in range( 0x110000 ): leaf.append( props.setdefault( prop( cp ), len( props ) ) )
+
+mid, leaves = stage( leaf, 1 << LEAF )
+top, mids   = stage( mid,  1 << MID  )
+order       = sorted( props, key = props.get )
+
+print( """#ifndef UNICODETABLES_H
+#define UNICODETABLES_H
+
+// generated by unicodeTables.py from Unicode %s, do not edit
+// classes and simple case folding of the code points above 0x7F, a fold
+// only when both sides are above 0x7F and have the same UTF-8 length
+
+#define UNI_ALPHA 1
+#define UNI_DIGIT 2
+#define UNI_SPACE 4
+""" % unicodedata.unidata_version )
+print( array( "unsigned char ", "uniTop",   top    ) )
+print( array( "unsigned short", "uniMid",   mids   ) )
+print( array( "unsigned char ", "uniLeaf",  leaves ) )
+print( array( "unsigned char ", "uniClass", [ p[0] for p in order ] ) )
+print( array( "int           ", "uniFold",  [ p[1] for p in order ] ) )
+print( """static int propCode( const int cp ){
+  return uniLeaf[ uniMid[ uniTop[ cp >> %d ] << %d | (cp >> %d & %d) ] << %d | (cp & %d) ];
+}
+
+static int classCode( const int cp ){ return cp >= 0x80 && cp < 0x110000 ? uniClass[ propCode( cp ) ] : 0; }
+static int foldCode ( const int cp ){ return cp >= 0x80 && cp < 0x110000 ? cp + uniFold[ propCode( cp ) ] : cp; }
+
+#endif""" % (LEAF + MID, MID, LEAF, (1 << MID) - 1, LEAF, (1 << LEAF) - 1) )
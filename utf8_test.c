@@ -427,6 +427,43 @@ int raptorTest(){
   PUT_TEST( "R▲ptor Test", "<▲ptor|est>", "C##43 ##1##2", "C#43 #1#2" );
   PUT_TEST( "R▲ptor Test", "<▲ptor|est>", "##R▲ptor ##Test", "#R▲ptor #Test" );
   PUT_TEST( "R▲ptor Test Fest", "<R▲ptor> <Test>", "#1_#2", "R▲ptor_Test" );
+  PUT_TEST( "x▲y▲▲z", "<[^z]{2,4}>", "#1", "x▲y▲" );
+  PUT_TEST( "añb▲c ñ", "<.+>", "#1", "añb▲c ñ" );
+  PUT_TEST( "aaa▲ :d", "<:A{3}>", "#1", "▲ :" );
+  PUT_TEST( "ab▲▲▲cd", "<▲+>", "#1", "▲▲▲" );
+  NTEST( "▲▲▲a", "▲{2}a", 1 );
+  NTEST( "x▲b ▲b ▲▲b a▲", "▲b|a▲", 4 );
+  NTEST( "▲x-▲y ▲-z", "▲:a-▲:a|▲-:a", 2 );
+  NTEST( "a▲1 b▲ c▲22", "#$:a▲:d+", 1 );
+  NTEST( "x▲b ñu, gnü ▲▲ Ñu", "#*añ|▲b|cé|dó|eú|ñu|gnü|h▲", 4 );
+  NTEST( "▲▲:a ñ▲▲:b ▲:c", "(▲|ñ)?▲::<:a>", 2 );
+  NTEST( "é▲x ▲▲xy", ".▲x", 2 );
+  NTEST( "añ▲ ▲ñ▲b", "#$[^▲]", 1 );
+  PUT_TEST( "añ▲ ▲ñ▲", "#$<ñ▲>", "#1", "ñ▲" );
+  NTEST( "ab1 cd2 x3", ".:d", 3 );
+  NTEST( "ab1 cd2 é3", ".:d", 3 );
+  PUT_TEST( "ab1 é2 c3", "[^x]<[^y]>:d", "#1", "b" );
+  PUT_TEST( "ab1 cd2 c3", "[^x]<[^y]>:d", "#1#2#3", "bdc" );
+  PUT_TEST( "xyz αβγω ψa", "<[α-ω]+>", "#1", "αβγω" );
+  NTEST( "añb ñé z▲", "[a-ñ]", 6 );
+  NTEST( "añb ñé z▲", "#^[a-ñ]+", 1 );
+  NTEST( "añ▲ αωx", "[^α-ω▲]", 4 );
+  NTEST( "a ñ-b", "[^ñ- ]", 2 );
+  NTEST( "a ñ-b ó", "[ó-ñ]", 3 );
+  NTEST( "ñu ▲ 日本", "[^:s-▲ñ]", 3 );
+  PUT_TEST( "El niño comió piña", "<[A-Za-zñáéíóúü]+>", "#1#2#3#4", "Elniñocomiópiña" );
+  PUT_TEST( "Ñandú, camión y pingüino", "<[áéíóúüñÑ]+>", "#1#2#3#4", "Ñúóü" );
+  PUT_TEST( "ab日本語cd", "<[語本日中文]+>", "#1", "日本語" );
+  NTEST( "niño 123 ñandú", ":a+", 2 );
+  NTEST( "añb", ":A", 0 );
+  PUT_TEST( "über, straße", "<:w+>", "#1-#2", "über-straße" );
+  NTEST( "٣٤ 56", ":d+", 2 );
+  NTEST( "a b　c", ":s", 2 );
+  NTEST( "ΣΟΦΙΑ σοφια σοφιας", "#*σοφια", 3 );
+  PUT_TEST( "el ÑANDÚ", "#*<ñandú>", "#1", "ÑANDÚ" );
+  NTEST( "ΑΒΓ αβγ", "[α-ω]+", 1 );
+  NTEST( "ΑΒΓ αβγ", "#*[α-ω]+", 2 );
+  NTEST( "\xe2\x84\xaa", "#*k", 0 );
 
 
   printf( "TEST %d *** ERRS %d\n\n", total, errs );